@@ -9,11 +9,17 @@
 #include <Glacier/ZScene.h>
 #include <Glacier/ZString.h>
 #include <chrono>
+#include <sstream>
 #include <variant>
 #include <winhttp.h>
+#include "DynamicObject.h"
 #include "Events.h"
 #include "KillConfirmation.h"
+#include "JsonTextWriter.h"
 #include "KillMethod.h"
+#include "MessagePack.h"
+#include "SpinImport.h"
+#include "SpinParseCache.h"
 #include "SpinParser.h"
 #include "json.hpp"
 #include "util.h"
@@ -35,6 +41,12 @@ static auto randomVectorElement(const std::vector<T>& vec) -> const T&
 
 Croupier::Croupier() : sharedSpin(spin), respinAction("Respin"), shuffleAction("Shuffle") {
 	this->SetupEvents();
+	this->SetupFrameTasks();
+	// Sized for typical events up front so the game thread rarely has to grow a slot.
+	this->eventQueue.forEachSlot([](QueuedEvent& slot) {
+		slot.name.reserve(64);
+		slot.payload.reserve(2048);
+	});
 	this->rules = makeRouletteRuleset(this->ruleset);
 
 	CHAR filename[MAX_PATH] = {};
@@ -43,8 +55,12 @@ Croupier::Croupier() : sharedSpin(spin), respinAction("Respin"), shuffleAction("
 }
 
 Croupier::~Croupier() {
-	this->SaveConfiguration();
 	this->UninstallHooks();
+	this->StopEventWorker();
+	// A save that's still waiting for its frame is queued now, and the writer finishes it before stopping.
+	this->UpdateState([this] { this->frameScheduler.flush(this->saveConfigurationTask); });
+	this->StopConfigWriter();
+	this->eventLog.close();
 }
 
 auto Croupier::LoadConfiguration() -> void {
@@ -85,7 +101,6 @@ auto Croupier::LoadConfiguration() -> void {
 		return v;
 	};
 
-	bool inHistorySection = false;
 	auto cmds = std::map<std::string, std::function<void (std::string_view val)>> {
 		{"timer", [this, parseBool](std::string_view val) { this->config.timer = parseBool(val, this->config.timer); }},
 		{"streak", [this, parseBool](std::string_view val) { this->config.streak = parseBool(val, this->config.streak); }},
@@ -99,6 +114,7 @@ auto Croupier::LoadConfiguration() -> void {
 			else this->config.overlayDockMode = DockMode::None;
 		}},
 		{"spin_overlay_confirmations", [this, parseBool](std::string_view val) { this->config.overlayKillConfirmations = parseBool(val, this->config.overlayKillConfirmations); }},
+		{"record_events", [this, parseBool](std::string_view val) { this->config.recordEvents = parseBool(val, this->config.recordEvents); }},
 		{"ruleset", [this](std::string_view val) { this->config.ruleset = getRulesetByName(val).value_or(this->config.ruleset); }},
 		{"ruleset_medium", [this, parseBool](std::string_view val) { this->config.customRules.enableMedium = parseBool(val, this->config.customRules.enableMedium); }},
 		{"ruleset_hard", [this, parseBool](std::string_view val) { this->config.customRules.enableHard = parseBool(val, this->config.customRules.enableHard); }},
@@ -136,18 +152,23 @@ auto Croupier::LoadConfiguration() -> void {
 		}},
 	};
 
-	auto parseHistorySection = [this](std::string_view line) {
-		auto spin = SpinParser::parse(line);
-		if (!spin) return;
+	auto parseHistorySection = [this](std::string_view history) {
+		for (auto& result : importSpins(history)) {
+			if (!result.ok()) {
+				Logger::Warn("Skipping spin history line {}: {}", result.line, result.error);
+				continue;
+			}
 
-		this->spinHistory.emplace(std::move(*spin));
+			this->spinHistory.emplace(std::move(*result.spin));
+		}
 	};
 
 	for (const auto& sv : split(content, "\n")) {
-		if (inHistorySection)
-			parseHistorySection(sv);
-		else if (trim(sv) == "[history]")
-			inHistorySection = true;
+		if (trim(sv) == "[history]") {
+			auto historyStart = static_cast<size_t>(sv.data() + sv.size() - content.data());
+			parseHistorySection(std::string_view(content).substr(historyStart));
+			break;
+		}
 		else {
 			auto tokens = split(sv, " ", 2);
 			if (tokens.size() < 2) continue;
@@ -159,10 +180,19 @@ auto Croupier::LoadConfiguration() -> void {
 }
 
 auto Croupier::SaveConfiguration() -> void {
-	std::string content;
-	const auto filepath = this->modulePath / "mods" / "Croupier" / "croupier.txt";
+	this->frameScheduler.request(this->saveConfigurationTask);
+}
+
+auto Croupier::WriteConfiguration() -> void {
+	{
+		auto lock = std::unique_lock(this->configWriteMutex);
+		this->pendingConfiguration = this->FormatConfiguration();
+	}
+	this->configWriteCondition.notify_one();
+}
 
-	this->file.open(filepath, std::ios::out | std::ios::trunc);
+auto Croupier::FormatConfiguration() const -> std::string {
+	std::ostringstream out;
 
 	auto spinOverlayDock = "none";
 	switch (this->config.overlayDockMode) {
@@ -180,25 +210,26 @@ auto Croupier::SaveConfiguration() -> void {
 		break;
 	}
 
-	std::println(this->file, "timer {}", this->config.timer ? "true" : "false");
-	std::println(this->file, "streak {}", this->config.streak ? "true" : "false");
-	std::println(this->file, "streak_current {}", this->config.streakCurrent);
-	std::println(this->file, "spin_overlay {}", this->config.spinOverlay ? "true" : "false");
-	std::println(this->file, "spin_overlay_dock {}", spinOverlayDock);
-	std::println(this->file, "spin_overlay_confirmations {}", this->config.overlayKillConfirmations ? "true" : "false");
+	std::println(out, "timer {}", this->config.timer ? "true" : "false");
+	std::println(out, "streak {}", this->config.streak ? "true" : "false");
+	std::println(out, "streak_current {}", this->config.streakCurrent);
+	std::println(out, "spin_overlay {}", this->config.spinOverlay ? "true" : "false");
+	std::println(out, "spin_overlay_dock {}", spinOverlayDock);
+	std::println(out, "spin_overlay_confirmations {}", this->config.overlayKillConfirmations ? "true" : "false");
+	std::println(out, "record_events {}", this->config.recordEvents ? "true" : "false");
 	const auto rulesetName = getRulesetName(this->config.ruleset);
-	if (rulesetName) std::println(this->file, "ruleset {}", rulesetName.value());
-	std::println(this->file, "ruleset_medium {}", this->config.customRules.enableMedium ? "true" : "false");
-	std::println(this->file, "ruleset_hard {}", this->config.customRules.enableHard ? "true" : "false");
-	std::println(this->file, "ruleset_extreme {}", this->config.customRules.enableExtreme ? "true" : "false");
-	std::println(this->file, "ruleset_impossible {}", this->config.customRules.enableImpossible ? "true" : "false");
-	std::println(this->file, "ruleset_buggy {}", this->config.customRules.enableBuggy ? "true" : "false");
-	std::println(this->file, "ruleset_generic_elims {}", this->config.customRules.genericEliminations ? "true" : "false");
-	std::println(this->file, "ruleset_live_complications {}", this->config.customRules.liveComplications ? "true" : "false");
-	std::println(this->file, "ruleset_live_complications_exclude_standard {}", this->config.customRules.liveComplicationsExcludeStandard ? "true" : "false");
-	std::println(this->file, "ruleset_live_complication_chance {}", this->config.customRules.liveComplicationChance);
-	std::println(this->file, "ruleset_melee_kill_types {}", this->config.customRules.meleeKillTypes ? "true" : "false");
-	std::println(this->file, "ruleset_thrown_kill_types {}", this->config.customRules.thrownKillTypes ? "true" : "false");
+	if (rulesetName) std::println(out, "ruleset {}", rulesetName.value());
+	std::println(out, "ruleset_medium {}", this->config.customRules.enableMedium ? "true" : "false");
+	std::println(out, "ruleset_hard {}", this->config.customRules.enableHard ? "true" : "false");
+	std::println(out, "ruleset_extreme {}", this->config.customRules.enableExtreme ? "true" : "false");
+	std::println(out, "ruleset_impossible {}", this->config.customRules.enableImpossible ? "true" : "false");
+	std::println(out, "ruleset_buggy {}", this->config.customRules.enableBuggy ? "true" : "false");
+	std::println(out, "ruleset_generic_elims {}", this->config.customRules.genericEliminations ? "true" : "false");
+	std::println(out, "ruleset_live_complications {}", this->config.customRules.liveComplications ? "true" : "false");
+	std::println(out, "ruleset_live_complications_exclude_standard {}", this->config.customRules.liveComplicationsExcludeStandard ? "true" : "false");
+	std::println(out, "ruleset_live_complication_chance {}", this->config.customRules.liveComplicationChance);
+	std::println(out, "ruleset_melee_kill_types {}", this->config.customRules.meleeKillTypes ? "true" : "false");
+	std::println(out, "ruleset_thrown_kill_types {}", this->config.customRules.thrownKillTypes ? "true" : "false");
 
 	std::string mapPoolValue;
 	for (const auto mission : this->config.missionPool) {
@@ -207,108 +238,78 @@ auto Croupier::SaveConfiguration() -> void {
 		if (mapPoolValue.size()) mapPoolValue += ", ";
 		mapPoolValue += codename.value();
 	}
-	std::println(this->file, "mission_pool {}", mapPoolValue);
+	std::println(out, "mission_pool {}", mapPoolValue);
 
-	std::println(this->file, "");
-	std::println(this->file, "[history]");
+	std::println(out, "");
+	std::println(out, "[history]");
 
 	for (const auto& spin : this->config.spinHistory) {
 		auto n = 0;
 
 		for (const auto& cond : spin.conditions) {
-			if (n++) std::print(this->file, ", ");
-			std::print(this->file, "{}: {} / {}", cond.targetName, cond.killMethod, cond.disguise);
+			if (n++) std::print(out, ", ");
+			std::print(out, "{}: {} / {}", cond.targetName, cond.killMethod, cond.disguise);
 		}
 
-		std::println(this->file, "");
+		std::println(out, "");
 	}
 
-	this->file.flush();
-	this->file.close();
+	return std::move(out).str();
 }
 
-auto Croupier::ParseSpin(std::string_view sv) -> std::optional<RouletteSpin> {
-	auto targetsSeparated = split(sv, ",");
-	auto lastTargetMission = eMission::NONE;
-	RouletteSpin spin;
-
-	for (const auto& targetCondText : targetsSeparated) {
-		auto condTextSeparatedTarget = split(targetCondText, ":");
-		if (condTextSeparatedTarget.size() < 2) return std::nullopt;
-
-		auto separatedConds = split(condTextSeparatedTarget[1], "/");
-		if (condTextSeparatedTarget.size() < 2) return std::nullopt;
-
-		auto targetName = std::string(Keyword::targetKeyToName(toUpperCase(trim(condTextSeparatedTarget[0]))));
-		if (targetName.empty()) return std::nullopt;
-
-		auto mission = getMissionForTarget(targetName);
-		if (mission == eMission::NONE) return std::nullopt;
-
-		auto missionGen = Missions::get(mission);
-		if (!missionGen) return std::nullopt;
-
-		if (lastTargetMission == eMission::NONE) spin = RouletteSpin(missionGen);
-		else if (mission != lastTargetMission) return std::nullopt;
-
-		lastTargetMission = mission;
-
-		auto condsFirstToken = trim(separatedConds[0]);
-
-		auto complication = eKillComplication::None;
-		auto killType = eKillType::Any;
-		auto killMethod = eKillMethod::NONE;
-		auto mapKillMethod = eMapKillMethod::NONE;
-
-		if (condsFirstToken.starts_with("(")) {
-			auto idx = condsFirstToken.find(")");
-			if (idx == condsFirstToken.npos) return std::nullopt;
-			auto complicationText = std::string(condsFirstToken.substr(1, idx - 1));
-			auto it = Keyword::getMap().find(toLowerCase(complicationText));
-			if (it != end(Keyword::getMap()) && std::holds_alternative<eKillComplication>(it->second))
-				complication = std::get<eKillComplication>(it->second);
-			condsFirstToken = trim(condsFirstToken.substr(idx + 1));
-		}
-
-		if (condsFirstToken.empty()) return std::nullopt;
-
-		auto methodTokens = split(condsFirstToken, " ");
-		for (const auto& methodToken : methodTokens) {
-			auto it = Keyword::getMap().find(toLowerCase(methodToken));
-			if (it == end(Keyword::getMap())) {
-				Logger::Error("SPIN PARSE: Unknown keyword '{}'", methodToken);
-				continue;
-			}
-			if (!std::visit(overloaded {
-				[&killType](eKillType kt) { killType = kt; return true; },
-				[&killMethod](eKillMethod km) { killMethod = km; return true; },
-				[&mapKillMethod](eMapKillMethod mkm) { mapKillMethod = mkm; return true; },
-				[](eKillComplication kc) { return false; },
-			}, it->second)) continue;
-		}
-
-		if (killMethod == eKillMethod::NONE && mapKillMethod == eMapKillMethod::NONE)
-			continue;
-
-		auto disguiseName = trim(separatedConds[1]);
-
-		auto target = missionGen->getTargetByName(targetName);
-		if (!target) return std::nullopt;
+auto Croupier::WriteConfigurationFile(const std::string& content) const -> void {
+	const auto filepath = this->modulePath / "mods" / "Croupier" / "croupier.txt";
+	std::ofstream file(filepath, std::ios::out | std::ios::trunc);
+	file << content;
+	if (!file) Logger::Error("Croupier: failed to write {}", filepath.string());
+}
 
-		auto disguise = missionGen->getDisguiseByName(disguiseName);
-		if (!disguise) {
-			Logger::Error("SPIN PARSE: Unknown disguise '{}'", disguiseName);
-			return std::nullopt;
-		}
+auto Croupier::StartConfigWriter() -> void {
+	auto lock = std::unique_lock(this->configWriteMutex);
+	if (this->configWriterRunning) return;
+	this->configWriterRunning = true;
+	this->configWriterThread = std::thread([this] { this->ProcessConfigWrites(); });
+}
 
-		spin.add(RouletteSpinCondition(*target, *disguise, killMethod, mapKillMethod, killType, complication));
+auto Croupier::StopConfigWriter() -> void {
+	{
+		auto lock = std::unique_lock(this->configWriteMutex);
+		this->configWriterRunning = false;
+	}
+	this->configWriteCondition.notify_one();
+	if (this->configWriterThread.joinable())
+		this->configWriterThread.join();
+
+	// Only left over if the writer never started.
+	if (this->pendingConfiguration) {
+		this->WriteConfigurationFile(*this->pendingConfiguration);
+		this->pendingConfiguration.reset();
 	}
+}
 
-	auto mission = Missions::get(lastTargetMission);
+auto Croupier::ProcessConfigWrites() -> void {
+	auto lock = std::unique_lock(this->configWriteMutex);
+	for (;;) {
+		this->configWriteCondition.wait(lock, [this] { return this->pendingConfiguration || !this->configWriterRunning; });
+		// Drain the last save before stopping.
+		if (!this->pendingConfiguration) break;
+
+		// Only the latest configuration matters, any queued while this one is written replace each other.
+		auto content = std::move(*this->pendingConfiguration);
+		this->pendingConfiguration.reset();
+		lock.unlock();
+		this->WriteConfigurationFile(content);
+		lock.lock();
+	}
+}
 
-	if (spin.getConditions().size() < mission->getTargets().size())
+auto Croupier::ParseSpin(std::string_view sv) -> std::optional<RouletteSpin> {
+	std::string error;
+	auto spin = parseSpinCached(sv, &error);
+	if (!spin || !spin->getMission()) {
+		Logger::Error("SPIN PARSE: {}", error);
 		return std::nullopt;
-
+	}
 	return spin;
 }
 
@@ -317,12 +318,21 @@ auto Croupier::OnEngineInitialized() -> void {
 
 	client = std::make_unique<CroupierClient>();
 	client->start();
+	this->StartEventWorker();
+	this->StartConfigWriter();
 	this->InstallHooks();
 	this->LoadConfiguration();
 
 	if (this->config.missionPool.empty())
 		this->SetDefaultMissionPool();
 
+	if (this->config.recordEvents) {
+		auto const now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+		auto const path = this->modulePath / "mods" / "Croupier" / "events" / std::format("{:%Y%m%d-%H%M%S}.bin", now);
+		if (this->eventLog.open(path)) this->recordingEvents = true;
+		else Logger::Warn("Croupier: could not open event log {}", path.string());
+	}
+
 	this->PreviousSpin();
 }
 
@@ -355,42 +365,66 @@ auto Croupier::UninstallHooks() -> void {
 }
 
 auto Croupier::OnFrameUpdate(const SGameUpdateEvent& ev) -> void {
-	this->ProcessSpinState();
-	this->ProcessClientMessages();
-	this->ProcessLoadRemoval();
+	this->UpdateState([this] { this->frameScheduler.runFrame(); });
+}
+
+auto Croupier::SetupFrameTasks() -> void {
+	// Load removal timing is sent to the timer, so it can't wait.
+	this->frameScheduler.addPeriodic("Load Removal", eFrameTaskPriority::Urgent, {}, [this] { this->ProcessLoadRemoval(); });
+	this->frameScheduler.addPeriodic("Spin State", eFrameTaskPriority::Normal, {}, [this] { this->ProcessSpinState(); });
+	this->frameScheduler.addPeriodic("Client Messages", eFrameTaskPriority::Normal, {}, [this] { this->ProcessClientMessages(); });
+	this->saveConfigurationTask = this->frameScheduler.addOnRequest("Save Configuration", eFrameTaskPriority::Deferred, [this] { this->WriteConfiguration(); });
 }
 
 auto Croupier::ProcessSpinState() -> void {
 	if (this->spinCompleted) return;
-	if (this->sharedSpin.hasLoadedGame) return;
-	if (this->sharedSpin.spin.getConditions().empty()) return;
+	// Only pacified targets need watching, in case they come round.
+	if (!this->sharedSpin.isAnyTargetPacified()) return;
 
-	for (int i = 0; i < *Globals::NextActorId; ++i) {
-		auto const& actorRef = Globals::ActorManager->m_aActiveActors[i]; 
-		if (!actorRef.m_pInterfaceRef) continue;
+	if (this->targetActorsDirty || this->targetActorsIndexedCount != *Globals::NextActorId)
+		this->IndexTargetActors();
 
-		auto& actor = *actorRef.m_pInterfaceRef;
+	for (auto const& targetActor : this->targetActors) {
+		auto const& actorRef = Globals::ActorManager->m_aActiveActors[targetActor.slot];
 
-		auto repoEntity = actorRef.m_ref.QueryInterface<ZRepositoryItemEntity>();
-		auto repoId = std::string{repoEntity->m_sId.ToString()};
+		// The slot has been reused, check again next frame.
+		if (actorRef.m_pInterfaceRef != targetActor.actor) {
+			this->targetActorsDirty = true;
+			continue;
+		}
 
+		auto& actor = *targetActor.actor;
 		if (!actor.m_bUnk16) continue; // m_bUnk16 = is target (and still alive)
-		
-		auto targetId = GetTargetByRepoID(repoId);
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-
-		for (auto i = 0; i < conditions.size() && i < this->sharedSpin.killValidations.size(); ++i) {
-			auto& cond = conditions[i];
-			auto& target = cond.target.get();
-			if (targetId != target.getID()) continue;
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-			if (!kc.isPacified) break;
-
-			auto isPacified = actor.IsPacified();
-			auto isDead = actor.IsDead();
-
-			if (!actor.IsPacified() && !actor.IsDead())
-				kc.isPacified = false;
+
+		auto const& kc = this->sharedSpin.getKillConfirmation(targetActor.condition);
+		if (!kc.isPacified) continue;
+
+		if (!actor.IsPacified() && !actor.IsDead()) {
+			this->sharedSpin.playerCameRound(targetActor.condition);
+			this->spinSnapshotDirty = true;
+		}
+	}
+}
+
+auto Croupier::IndexTargetActors() -> void {
+	auto const& conditions = this->sharedSpin.spin.getConditions();
+	this->targetActors.clear();
+	this->targetActorsIndexedCount = *Globals::NextActorId;
+	this->targetActorsDirty = false;
+
+	for (int i = 0; i < this->targetActorsIndexedCount; ++i) {
+		auto const& actorRef = Globals::ActorManager->m_aActiveActors[i];
+		if (!actorRef.m_pInterfaceRef) continue;
+		if (!actorRef.m_pInterfaceRef->m_bUnk16) continue;
+
+		auto repoEntity = actorRef.m_ref.QueryInterface<ZRepositoryItemEntity>();
+		if (!repoEntity) continue;
+
+		auto targetId = GetTargetByRepoID(std::string{repoEntity->m_sId.ToString()});
+
+		for (size_t j = 0; j < conditions.size() && j < this->sharedSpin.killValidations.size(); ++j) {
+			if (conditions[j].target.get().getID() != targetId) continue;
+			this->targetActors.push_back({i, actorRef.m_pInterfaceRef, j});
 		}
 	}
 }
@@ -398,6 +432,8 @@ auto Croupier::ProcessSpinState() -> void {
 auto Croupier::ProcessClientMessages() -> void {
 	ClientMessage message;
 	if (this->client->tryTakeMessage(message)) {
+		this->spinSnapshotDirty = true;
+
 		switch (message.type) {
 			case eClientMessage::SpinData:
 				return ProcessSpinDataMessage(message);
@@ -496,7 +532,7 @@ auto Croupier::ProcessMissionsMessage(const ClientMessage& message) -> void {
 }
 
 auto Croupier::ProcessSpinDataMessage(const ClientMessage& message) -> void {
-	auto spin = SpinParser::parse(message.args);
+	auto spin = parseSpinCached(message.args);
 	if (!spin.has_value()) return;
 
 	this->spin = std::move(*spin);
@@ -507,11 +543,11 @@ auto Croupier::ProcessSpinDataMessage(const ClientMessage& message) -> void {
 }
 
 auto Croupier::SendAutoSpin(eMission mission) -> void {
-	this->client->send(eClientMessage::AutoSpin, {getMissionCodename(mission).value_or("").data()});
+	this->SendClientMessage(eClientMessage::AutoSpin, {getMissionCodename(mission).value_or("").data()});
 }
 
 auto Croupier::SendRespin(eMission mission) -> void {
-	this->client->send(eClientMessage::Respin, {getMissionCodename(mission).value_or("").data()});
+	this->SendClientMessage(eClientMessage::Respin, {getMissionCodename(mission).value_or("").data()});
 }
 
 auto Croupier::SendMissions() -> void {
@@ -524,43 +560,43 @@ auto Croupier::SendMissions() -> void {
 		buffer += *codename;
 	}
 
-	this->client->send(eClientMessage::Missions, {buffer});
+	this->SendClientMessage(eClientMessage::Missions, {buffer});
 }
 
 auto Croupier::SendToggleSpinLock() -> void {
-	this->client->send(eClientMessage::ToggleSpinLock);
+	this->SendClientMessage(eClientMessage::ToggleSpinLock);
 }
 
 auto Croupier::SendToggleTimer(bool enable) -> void {
-	this->client->send(eClientMessage::ToggleTimer, {enable ? "1" : "0"});
+	this->SendClientMessage(eClientMessage::ToggleTimer, {enable ? "1" : "0"});
 }
 
 auto Croupier::SendLoadStarted() -> void {
-	this->client->send(eClientMessage::LoadStarted);
+	this->SendClientMessage(eClientMessage::LoadStarted);
 }
 
 auto Croupier::SendLoadFinished() -> void {
-	this->client->send(eClientMessage::LoadFinished);
+	this->SendClientMessage(eClientMessage::LoadFinished);
 }
 
 auto Croupier::SendResetStreak() -> void {
-	this->client->send(eClientMessage::ResetStreak);
+	this->SendClientMessage(eClientMessage::ResetStreak);
 }
 
 auto Croupier::SendResetTimer() -> void {
-	this->client->send(eClientMessage::ResetTimer);
+	this->SendClientMessage(eClientMessage::ResetTimer);
 }
 
 auto Croupier::SendStartTimer() -> void {
-	this->client->send(eClientMessage::StartTimer);
+	this->SendClientMessage(eClientMessage::StartTimer);
 }
 
 auto Croupier::SendPauseTimer(bool pause) -> void {
-	this->client->send(eClientMessage::PauseTimer, {pause ? "1" : "0"});
+	this->SendClientMessage(eClientMessage::PauseTimer, {pause ? "1" : "0"});
 }
 
 auto Croupier::SendSplitTimer() -> void {
-	this->client->send(eClientMessage::SplitTimer);
+	this->SendClientMessage(eClientMessage::SplitTimer);
 }
 
 auto Croupier::SendSpinData() -> void {
@@ -598,31 +634,31 @@ auto Croupier::SendSpinData() -> void {
 		data += std::format("{}: {}{} / {}", Keyword::getForTarget(cond.target.get().getName()), prefixes, cond.killMethod.name, cond.disguise.get().name);
 		prefixes.clear();
 	}
-	this->client->send(eClientMessage::SpinData, { data });
+	this->SendClientMessage(eClientMessage::SpinData, { data });
 }
 
 auto Croupier::SendNext() -> void {
-	this->client->send(eClientMessage::Next);
+	this->SendClientMessage(eClientMessage::Next);
 }
 
 auto Croupier::SendPrev() -> void {
-	this->client->send(eClientMessage::Prev);
+	this->SendClientMessage(eClientMessage::Prev);
 }
 
 auto Croupier::SendRandom() -> void {
-	this->client->send(eClientMessage::Random);
+	this->SendClientMessage(eClientMessage::Random);
 }
 
 auto Croupier::SendMissionFailed() -> void {
-	this->client->send(eClientMessage::MissionFailed);
+	this->SendClientMessage(eClientMessage::MissionFailed);
 }
 
 auto Croupier::SendMissionComplete() -> void {
-	this->client->send(eClientMessage::MissionComplete, {this->sharedSpin.isSA ? "1" : "0", std::to_string(this->sharedSpin.exitIGT)});
+	this->SendClientMessage(eClientMessage::MissionComplete, {this->sharedSpin.isSA ? "1" : "0", std::to_string(this->sharedSpin.exitIGT)});
 }
 
 auto Croupier::SendMissionOutroBegin() -> void {
-	this->client->send(eClientMessage::MissionOutroBegin);
+	this->SendClientMessage(eClientMessage::MissionOutroBegin);
 }
 
 auto Croupier::SendMissionStart(const std::string& locationId, const std::string& entranceId, const std::vector<LoadoutItemEventValue>& loadout) -> void {
@@ -631,7 +667,7 @@ auto Croupier::SendMissionStart(const std::string& locationId, const std::string
 		if (!loadoutStr.empty()) loadoutStr += ",";
 		loadoutStr += std::format("\"{}\"", item.RepositoryId);
 	}
-	this->client->send(eClientMessage::MissionStart, {entranceId, "[" + loadoutStr + "]"});
+	this->SendClientMessage(eClientMessage::MissionStart, {entranceId, "[" + loadoutStr + "]"});
 }
 
 auto Croupier::SendKillValidationUpdate() -> void {
@@ -648,7 +684,37 @@ auto Croupier::SendKillValidationUpdate() -> void {
 			Keyword::getForTarget(kc.specificTarget)
 		);
 	}
-	this->client->send(eClientMessage::KillValidation, { data });
+	this->SendClientMessage(eClientMessage::KillValidation, { data });
+}
+
+auto Croupier::SendClientMessage(eClientMessage type, std::initializer_list<std::string> args) -> void {
+	if (!this->client->isConnected()) return;
+	this->clientOutbox.emplace_back(type, args);
+}
+
+auto Croupier::PublishSpinSnapshot() -> void {
+	auto snapshot = std::make_shared<SpinSnapshot>();
+
+	for (auto const& cond : this->spin.getConditions()) {
+		snapshot->conditions.push_back({
+			std::format("{}: {} / {}", cond.target.get().getName(), cond.methodName, cond.disguise.get().name),
+			this->sharedSpin.getTargetKillValidation(cond.target.get().getID()),
+		});
+	}
+
+	snapshot->timeStarted = this->sharedSpin.timeStarted;
+	snapshot->timeElapsed = this->sharedSpin.timeElapsed;
+	snapshot->isPlaying = this->sharedSpin.isPlaying;
+	snapshot->isFinished = this->sharedSpin.isFinished;
+	snapshot->spinOverlay = this->config.spinOverlay;
+	snapshot->overlayKillConfirmations = this->config.overlayKillConfirmations;
+	snapshot->timer = this->config.timer;
+	snapshot->streak = this->config.streak;
+	snapshot->streakCurrent = this->config.streakCurrent;
+	snapshot->overlayDockMode = this->config.overlayDockMode;
+
+	this->spinSnapshot.store(std::move(snapshot));
+	this->spinSnapshotDirty = false;
 }
 
 auto Croupier::OnDrawMenu() -> void {
@@ -661,11 +727,20 @@ auto Croupier::OnDrawUI(bool focused) -> void {
 	this->DrawSpinUI(focused);
 
 	if (!focused) return;
+	if (!this->showUI && !this->showManualModeUI && !this->showCustomRulesetUI && !this->showEditMissionPoolUI) return;
+
+	// These windows bind widgets straight to the spin and configuration, so they hold the state lock while they're open,
+	// and anything they change could be on the overlay.
+	this->UpdateState([this, focused] {
+		this->DrawEditSpinUI(focused);
+		this->DrawCustomRulesetUI(focused);
+		this->DrawEditMissionPoolUI(focused);
+		this->DrawSettingsUI(focused);
+		this->spinSnapshotDirty = true;
+	});
+}
 
-	this->DrawEditSpinUI(focused);
-	this->DrawCustomRulesetUI(focused);
-	this->DrawEditMissionPoolUI(focused);
-
+auto Croupier::DrawSettingsUI(bool focused) -> void {
 	if (!this->showUI) return;
 
 	ImGui::PushFont(SDK()->GetImGuiBlackFont());
@@ -887,6 +962,7 @@ auto Croupier::OnDrawUI(bool focused) -> void {
 		}
 
 		ImGui::SetWindowFontScale(1.0);
+		this->DrawFrameTaskStats();
 		ImGui::PopFont();
 	}
 
@@ -894,18 +970,55 @@ auto Croupier::OnDrawUI(bool focused) -> void {
 	ImGui::PopFont();
 }
 
+auto Croupier::DrawFrameTaskStats() -> void {
+	if (!ImGui::CollapsingHeader("Frame Tasks")) return;
+
+	ImGui::Text("Budget: %lld us", static_cast<long long>(this->frameScheduler.getBudget().count()));
+
+	if (!ImGui::BeginTable("FrameTasks", 6)) return;
+
+	ImGui::TableSetupColumn("Task");
+	ImGui::TableSetupColumn("Runs");
+	ImGui::TableSetupColumn("Mean");
+	ImGui::TableSetupColumn("P99");
+	ImGui::TableSetupColumn("Max");
+	ImGui::TableSetupColumn("Deferred");
+	ImGui::TableHeadersRow();
+
+	for (auto const& task : this->frameScheduler.getTasks()) {
+		auto const& timings = task.timings;
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(task.name.c_str());
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(timings.runs));
+		ImGui::TableNextColumn();
+		ImGui::Text("%lld us", static_cast<long long>(timings.mean().count()));
+		ImGui::TableNextColumn();
+		ImGui::Text("%lld us", static_cast<long long>(timings.percentile(0.99).count()));
+		ImGui::TableNextColumn();
+		ImGui::Text("%lld us", static_cast<long long>(timings.max.count()));
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(timings.deferrals));
+	}
+
+	ImGui::EndTable();
+}
+
 auto Croupier::DrawSpinUI(bool focused) -> void {
-	if (!this->config.spinOverlay) return;
+	// Drawn every frame, so it only reads the published snapshot and never waits on the state lock.
+	auto const snapshot = this->spinSnapshot.load();
+	if (!snapshot || !snapshot->spinOverlay) return;
 
 	ImGui::PushFont(SDK()->GetImGuiBlackFont());
 
 	auto viewportSize = ImGui::GetMainViewport()->Size;
 	auto flags = static_cast<ImGuiWindowFlags>(ImGuiWindowFlags_AlwaysAutoResize);
 
-	if (this->config.overlayDockMode != DockMode::None || !focused)
+	if (snapshot->overlayDockMode != DockMode::None || !focused)
 		flags |= ImGuiWindowFlags_NoTitleBar;
 
-	switch (this->config.overlayDockMode) {
+	switch (snapshot->overlayDockMode) {
 		case DockMode::TopLeft:
 			ImGui::SetNextWindowPos({0, 0});
 			break;
@@ -920,21 +1033,18 @@ auto Croupier::DrawSpinUI(bool focused) -> void {
 			break;
 	}
 
-	if (ImGui::Begin(ICON_MD_CASINO " CROUPIER - SPIN", &this->config.spinOverlay, flags)) {
+	auto open = true;
+	if (ImGui::Begin(ICON_MD_CASINO " CROUPIER - SPIN", &open, flags)) {
 		this->overlaySize = ImGui::GetWindowSize();
 
 		ImGui::PushFont(SDK()->GetImGuiBoldFont());
 
-		auto elapsed = std::chrono::seconds::zero();
-		auto& conds = this->spin.getConditions();
-
-		elapsed = this->sharedSpin.getTimeElapsed();
-		for (auto i = 0; i < conds.size(); ++i) {
-			auto& cond = conds[i];
-			auto kc = this->sharedSpin.getTargetKillValidation(cond.target.get().getID());
+		auto const elapsed = snapshot->getTimeElapsed();
+		for (auto const& cond : snapshot->conditions) {
+			auto const& kc = cond.killValidation;
 			auto validation = " - "s;
 
-			if (this->config.overlayKillConfirmations) {
+			if (snapshot->overlayKillConfirmations) {
 				if (kc.correctMethod == eKillValidationType::Unknown)
 					validation += "Unknown"s;
 				else if (kc.correctMethod == eKillValidationType::Invalid)
@@ -946,13 +1056,13 @@ auto Croupier::DrawSpinUI(bool focused) -> void {
 			}
 			else validation = "";
 
-			auto str = std::format("{}: {} / {}{}", cond.target.get().getName(), cond.methodName, cond.disguise.get().name, validation);
+			auto str = cond.text + validation;
 			ImGui::Text(str.c_str());
 		}
 
 		auto text = std::string();
 
-		if (this->config.timer) {
+		if (snapshot->timer) {
 			if (!text.empty()) text += " - ";
 			auto timeFormat = std::string();
 			auto const includeHr = std::chrono::duration_cast<std::chrono::hours>(elapsed).count() >= 1;
@@ -960,9 +1070,9 @@ auto Croupier::DrawSpinUI(bool focused) -> void {
 			text += time;
 		}
 
-		if (this->config.streak) {
+		if (snapshot->streak) {
 			if (!text.empty()) text += " - ";
-			text += std::format("Streak: {}", this->config.streakCurrent);
+			text += std::format("Streak: {}", snapshot->streakCurrent);
 		}
 
 		if (!text.empty()) {
@@ -978,6 +1088,13 @@ auto Croupier::DrawSpinUI(bool focused) -> void {
 
 	ImGui::End();
 	ImGui::PopFont();
+
+	if (!open) {
+		this->UpdateState([this] {
+			this->config.spinOverlay = false;
+			this->spinSnapshotDirty = true;
+		});
+	}
 }
 
 auto Croupier::DrawEditSpinUI(bool focused) -> void {
@@ -1404,801 +1521,46 @@ auto Croupier::LogSpin() -> void {
 	Logger::Info("Croupier: {}", spinText);
 }
 
-auto lastThrownItem = ""s;
-
 auto Croupier::SetupEvents() -> void {
-	events.listen<Events::ContractStart>([this](const ServerEvent<Events::ContractStart>& ev) {
-		this->sharedSpin.playerStart();
-		this->sharedSpin.locationId = ev.Value.LocationId;
-		this->sharedSpin.loadout = ev.Value.Loadout;
-
-		this->SendKillValidationUpdate();
+	// Spin tracking and kill validation, shared with the tools that replay recorded sessions.
+	this->sharedSpin.listen(this->events, this->killValidator, {
+		.log = [](std::string_view message) { Logger::Info("{}", message); },
+		.onValidationUpdate = [this] { this->SendKillValidationUpdate(); },
+		.onExit = [this] { this->SendMissionComplete(); },
+		.isIgnoring = [this] { return this->spinCompleted; },
 	});
-	events.listen<Events::HeroSpawn_Location>([this](const ServerEvent<Events::HeroSpawn_Location>& ev) {
-		this->SendMissionStart(this->sharedSpin.locationId, ev.Value.RepositoryId, this->sharedSpin.loadout);
-	});
-	events.listen<Events::IntroCutEnd>([this](const ServerEvent<Events::IntroCutEnd>& ev) {
-		this->sharedSpin.playerCutsceneEnd(ev.Timestamp);
-	});
-	events.listen<Events::ContractLoad>([this](auto& ev) {
-		this->sharedSpin.playerLoad();
-		this->SendKillValidationUpdate();
-	});
-	events.listen<Events::ExitGate>([this](const ServerEvent<Events::ExitGate>& ev) {
-		this->sharedSpin.playerExit(ev.Timestamp);
-
-		// Mark any unfulfilled kill methods as invalid (never killed a Berlin agent with correct requirements, destroyed heart instead of killing Soders or vice-versa, etc.)
-		auto const& conds = spin.getConditions();
-		for (auto& kv : this->sharedSpin.killValidations) {
-			if (kv.correctMethod == eKillValidationType::Incomplete)
-				kv.correctMethod = eKillValidationType::Invalid;
-		}
 
-		this->SendKillValidationUpdate();
-		this->SendMissionComplete();
+	events.listen<Events::HeroSpawn_Location>([this](const ServerEvent<Events::HeroSpawn_Location>& ev) {
+		this->SendMissionStart(this->sharedSpin.locationId, std::string(ev.Value.RepositoryId), this->sharedSpin.loadout);
 	});
 	events.listen<Events::ExitTango>([this](const ServerEvent<Events::ExitTango>& ev) {
 		this->SendMissionOutroBegin();
 	});
-	events.listen<Events::FacilityExitEvent>([this](const ServerEvent<Events::FacilityExitEvent>& ev) {
-		this->sharedSpin.playerExit(ev.Timestamp);
-
-		// Mark any unfulfilled kill methods as invalid (never killed a Berlin agent with correct requirements, destroyed heart instead of killing Soders or vice-versa, etc.)
-		auto const& conds = spin.getConditions();
-		for (auto& kv : this->sharedSpin.killValidations)
-		{
-			if (kv.correctMethod == eKillValidationType::Incomplete)
-				kv.correctMethod = eKillValidationType::Invalid;
-		}
-
-		this->SendKillValidationUpdate();
-		this->SendMissionComplete();
-	});
 	events.listen<Events::ContractEnd>([this](const ServerEvent<Events::ContractEnd>& ev) {
-		if (!this->sharedSpin.isFinished) {
-			this->sharedSpin.playerExit(ev.Timestamp);
-
-			// Mark any unfulfilled kill methods as invalid (never killed a Berlin agent with correct requirements, destroyed heart instead of killing Soders or vice-versa, etc.)
-			auto const& conds = spin.getConditions();
-			for (auto& kv : this->sharedSpin.killValidations) {
-				if (kv.correctMethod == eKillValidationType::Incomplete)
-					kv.correctMethod = eKillValidationType::Invalid;
-			}
-
-			this->SendKillValidationUpdate();
-			this->SendMissionComplete();
-		}
-
 		this->spinCompleted = true;
 	});
 	events.listen<Events::ContractFailed>([this](const ServerEvent<Events::ContractFailed>& ev) {
 		this->SendMissionFailed();
-		Logger::Info("Croupier: ContractFailed {}", ev.Value.value.dump());
-	});
-	events.listen<Events::StartingSuit>([this](const ServerEvent<Events::StartingSuit>& ev) {
-		if (this->spinCompleted) return;
-		this->sharedSpin.disguiseChanges.emplace_back(ev.Value.value, ev.Timestamp);
-	});
-	events.listen<Events::Disguise>([this](const ServerEvent<Events::Disguise>& ev) {
-		if (this->spinCompleted) return;
-		this->sharedSpin.disguiseChanges.emplace_back(ev.Value.value, ev.Timestamp);
-	});
-	events.listen<Events::ItemThrown>([this](const ServerEvent<Events::ItemThrown>& ev) {
-		lastThrownItem = ev.Value.RepositoryId;
+		Logger::Info("Croupier: ContractFailed {}", ev.toJson().value("Value", nlohmann::json()).dump());
 	});
 	events.listen<Events::Pacify>([this](const ServerEvent<Events::Pacify>& ev) {
-		if (!ev.Value.IsTarget) return;
 		if (this->spinCompleted) return;
-
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-		if (conditions.empty()) return;
-
-		auto targetId = GetTargetByRepoID(ev.Value.RepositoryId);
-
-		for (auto i = 0; i < conditions.size(); ++i) {
-			auto& cond = conditions[i];
-			auto& target = cond.target.get();
-
-			if (targetId != target.getID() && target.getName() != ev.Value.ActorName)
-				continue;
-
-			// If this pacification is a throw and the last thrown item is an impact explosive, ignore
-			// this as a pacification so lethal throws with impact explosives pass the 'live' condition.
-			if (ev.Value.KillMethodBroad == "throw" && cond.killType == eKillType::Impact) {
-				if (checkExplosiveKillType(lastThrownItem, eKillType::Impact)) return;
-			}
-
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-			kc.target = target.getID();
-			kc.isPacified = true;
-		}
+		this->targetActorsDirty = true;
 	});
-	events.listen<Events::C_Hungry_Hippo>([this](const ServerEvent<Events::C_Hungry_Hippo>& ev) {
-		if (this->spinCompleted) return;
-		auto const mission = this->sharedSpin.spin.getMission();
-		if (!mission) return;
-		if (mission->getMission() != eMission::SANTAFORTUNA_THREEHEADEDSERPENT) return;
-
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-		if (conditions.empty()) return;
-
-		for (auto i = 0; i < conditions.size(); ++i) {
-			auto const& cond = conditions[i];
-			if (cond.target.get().getID() != eTargetID::RicoDelgado) continue;
-			if (cond.specificKillMethod.method != eMapKillMethod::Rico_FeedToHippo) return;
-			
-			auto const& target = cond.target.get();
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-			kc.target = eTargetID::RicoDelgado;
-			kc.correctMethod = eKillValidationType::Valid;
-			this->SendKillValidationUpdate();
-			break;
-		}
-	});
-	events.listen<Events::TargetEscapeFoiled>([this](const ServerEvent<Events::TargetEscapeFoiled>& ev) {
-		if (this->spinCompleted) return;
-		auto const mission = this->sharedSpin.spin.getMission();
-		if (!mission) return;
-		if (mission->getMission() != eMission::HOKKAIDO_SITUSINVERSUS) return;
-
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-		if (conditions.empty()) return;
-
-		for (auto i = 0; i < conditions.size(); ++i) {
-			auto const& cond = conditions[i];
-			if (cond.target.get().getID() != eTargetID::YukiYamazaki) continue;
-			if (cond.specificKillMethod.method != eMapKillMethod::Yuki_SabotageCableCar) return;
-			
-			auto const& target = cond.target.get();
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-			kc.target = eTargetID::YukiYamazaki;
-			kc.correctMethod = eKillValidationType::Valid;
-			this->SendKillValidationUpdate();
-			break;
-		}
-	});
-	events.listen<Events::Kill>([this](const ServerEvent<Events::Kill>& ev) {
-		static auto isBerlinAgent = [](eTargetID id) -> bool {
-			switch (id) {
-			case eTargetID::Agent1:
-			case eTargetID::Agent2:
-			case eTargetID::Agent3:
-			case eTargetID::Agent4:
-			case eTargetID::Agent5:
-			case eTargetID::Agent6:
-			case eTargetID::Agent7:
-			case eTargetID::Agent8:
-			case eTargetID::Agent9:
-			case eTargetID::Agent10:
-			case eTargetID::Agent11:
-			case eTargetID::AgentBanner:
-			case eTargetID::AgentChamberlin:
-			case eTargetID::AgentDavenport:
-			case eTargetID::AgentGreen:
-			case eTargetID::AgentLowenthal:
-			case eTargetID::AgentMontgomery:
-			case eTargetID::AgentPrice:
-			case eTargetID::AgentRhodes:
-			case eTargetID::AgentSwan:
-			case eTargetID::AgentThames:
-			case eTargetID::AgentTremaine:
-				return true;
-			}
-			return false;
-		};
-
-		if (this->spinCompleted) return;
-
-		this->sharedSpin.killed.insert(ev.Value.RepositoryId);
-		this->sharedSpin.spottedNotKilled.erase(ev.Value.RepositoryId);
-
-		if (!ev.Value.IsTarget) {
-			if (ev.Value.KillContext != EDeathContext::eDC_NOT_HERO)
-				this->sharedSpin.voidSA();
-			return;
-		}
-
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-		if (conditions.empty()) return;
-
-		bool validationUpdated = false;
-		auto it = targetsByRepoId.find(ev.Value.RepositoryId);
-		auto targetId = it != end(targetsByRepoId) ? it->second : eTargetID::Unknown;
-
-		for (auto i = 0; i < conditions.size(); ++i) {
-			auto const& cond = conditions[i];
-			auto const& target = cond.target.get();
-			bool isApexPrey = isBerlinAgent(target.getID()) && isBerlinAgent(targetId);
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-
-			if (isApexPrey) {
-				if (kc.correctMethod != eKillValidationType::Incomplete)
-					continue;
-			}
-			else if (targetId != target.getID() && target.getName() != ev.Value.ActorName)
-				continue;
-
-			auto disguiseRepoId = ev.Value.OutfitIsHitmanSuit ? ev.Value.OutfitRepositoryId : transformDisguiseVariantRepoId(ev.Value.OutfitRepositoryId);
-			auto& reqDisguise = cond.disguise.get();
-			auto correctDisguise = false;
-			kc.target = target.getID();
-
-			// Target already killed? Confusion. Turn an invalid kill valid, but don't invalidate previously validated kills.
-			if (kc.correctMethod == eKillValidationType::Valid) {
-				if (!kc.correctDisguise) {
-					kc.correctDisguise = reqDisguise.any || (reqDisguise.suit ? ev.Value.OutfitIsHitmanSuit : reqDisguise.repoId == disguiseRepoId);
-					validationUpdated = true;
-				}
-				break;
-			}
-
-			kc.correctDisguise = reqDisguise.any || (reqDisguise.suit ? ev.Value.OutfitIsHitmanSuit : reqDisguise.repoId == disguiseRepoId);
-
-			if (!kc.correctDisguise && !reqDisguise.suit) {
-				Logger::Info("Invalid disguise '{}' (expected: '{}')", disguiseRepoId, reqDisguise.repoId);
-			}
-
-			if (cond.killComplication == eKillComplication::Live && kc.isPacified) {
-				kc.correctMethod = eKillValidationType::Invalid;
-
-				Logger::Info("Invalid kill, target was KO'd on death");
-			}
-			else if (cond.killMethod.method != eKillMethod::NONE) {
-				kc.correctMethod = ValidateKillMethod(target.getID(), ev, cond.killMethod.method, cond.killType);
-				if (kc.correctMethod != eKillValidationType::Valid) {
-					Logger::Info("Invalid kill '{}' (type: {})", cond.killMethod.name, static_cast<int>(cond.killType));
-					Logger::Info("{}", ev.json.dump());
-				}
-			}
-			else if (cond.specificKillMethod.method != eMapKillMethod::NONE)
-				kc.correctMethod = ValidateKillMethod(target.getID(), ev, cond.specificKillMethod.method, cond.killType);
-
-			if (isApexPrey) {
-				// If we're in an unspecified target mode, replace invalidations with incompletes
-				if (!kc.correctDisguise || kc.correctMethod == eKillValidationType::Invalid) {
-					kc.correctMethod = eKillValidationType::Incomplete;
-					continue;
-				}
-
-				// Fill in the info of the specific target killed
-				kc.specificTarget = targetId;
-			}
-
-			validationUpdated = true;
-		}
-
-		if (validationUpdated) this->SendKillValidationUpdate();
-	});
-	events.listen<Events::Level_Setup_Events>([this](const ServerEvent<Events::Level_Setup_Events>& ev) {
-		auto const& conditions = this->sharedSpin.spin.getConditions();
-		auto mission = this->sharedSpin.spin.getMission();
-
-
-		if (this->spinCompleted) return;
-
-		LevelSetupEvent data {};
-		//data.contractName = ev.Value.Contract_Name_metricvalue;
-		//data.location = ev.Value.Location_MetricValue;
-		data.event = ev.Value.Event_metricvalue;
-		data.timestamp = ev.Timestamp;
-		this->sharedSpin.levelSetupEvents.push_back(std::move(data));
-
-		if (!mission || mission->getMission() != eMission::HOKKAIDO_SITUSINVERSUS) return;
-		if (ev.Value.Contract_Name_metricvalue != "SnowCrane") return;
-
-		bool validationUpdated = false;
-
-		for (auto i = 0; i < conditions.size(); ++i) {
-			auto& cond = conditions[i];
-			if (cond.target.get().getID() != eTargetID::ErichSoders) continue;
-
-			auto& kc = this->sharedSpin.getKillConfirmation(i);
-			auto& reqDisguise = cond.disguise.get();
-			kc.target = cond.target.get().getID();
-
-			validationUpdated = true;
-
-			auto getSodersKillDelay = [](std::string_view kill) -> double {
-				if (kill == "Body_Kill") return 4;
-				if (kill == "Soder_Electrocuted") return 8;
-				if (kill == "Poison_Kill") return 12;
-				if (kill == "Spidermachine_Kill") return 13;
-				return 0;
-			};
-			auto getSodersKillTriggerDisguiseChange = [this, getSodersKillDelay](std::string_view kill, double timestamp) -> const DisguiseChange* {
-				auto const delay = getSodersKillDelay(kill);
-				return this->sharedSpin.getLastDisguiseChangeAtTimestamp(timestamp - delay);
-			};
-
-			auto const triggerDisguiseChange = getSodersKillTriggerDisguiseChange(ev.Value.Event_metricvalue, ev.Timestamp);
-
-			// There should be at least one disguise. If in doubt, trust the player...
-			if (!triggerDisguiseChange)
-				kc.correctDisguise = true;
-			// If we're not looking for a suit, just compare repo IDs
-			else if (!reqDisguise.suit)
-				kc.correctDisguise = toLowerCase(triggerDisguiseChange->disguiseRepoId) == reqDisguise.repoId;
-			// If it is suit, just check the repo ID does not match any non-suit disguises in the level (player-unlocked suit IDs are vast)
-			else {
-				auto isNotInSuit = false;
-				for (auto const& disguise : mission->getDisguises()) {
-					if (disguise.suit) continue;
-					if (disguise.repoId != triggerDisguiseChange->disguiseRepoId) continue;
-					isNotInSuit = true;
-					break;
-				}
-
-				kc.correctDisguise = !isNotInSuit;
-			}
-
-			if (!kc.correctDisguise && !reqDisguise.suit) {
-				Logger::Info("Invalid disguise '{}' (expected: '{}')", triggerDisguiseChange->disguiseRepoId, reqDisguise.repoId);
-			}
-
-			if (cond.specificKillMethod.method != eMapKillMethod::NONE) {
-				if (ev.Value.Event_metricvalue == "Heart_Kill")
-					kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_TrashHeart
-						|| cond.specificKillMethod.method == eMapKillMethod::Soders_ShootHeart
-						? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Spidermachine_Kill")
-					kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_RobotArms ? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Soder_Electrocuted")
-					kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_Electrocution ? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Poison_Kill")
-					kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_PoisonStemCells ? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else
-					validationUpdated = false;
-			}
-			else if (cond.killMethod.method != eKillMethod::NONE) {
-				if (ev.Value.Event_metricvalue == "Body_Kill")
-					kc.correctMethod = cond.killMethod.isGun
-						|| cond.killMethod.method == eKillMethod::Explosive
-						|| cond.killMethod.method == eKillMethod::Explosion
-						? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Heart_Kill")
-					kc.correctMethod = eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Spidermachine_Kill")
-					kc.correctMethod = eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Soder_Electrocuted")
-					kc.correctMethod = cond.killMethod.method == eKillMethod::Electrocution ? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else if (ev.Value.Event_metricvalue == "Poison_Kill")
-					kc.correctMethod = cond.killMethod.method == eKillMethod::ConsumedPoison ? eKillValidationType::Valid : eKillValidationType::Invalid;
-				else
-					validationUpdated = false;
-			}
-			else validationUpdated = false;
-		}
-
-		if (validationUpdated) this->SendKillValidationUpdate();
-	});
-	events.listen<Events::setpieces>([this](const ServerEvent<Events::setpieces>& ev) {
-		if (this->spinCompleted) return;
-
-		KillSetpieceEvent data{};
-		data.id = ev.Value.RepositoryId;
-		data.name = ev.Value.name_metricvalue;
-		data.type = ev.Value.setpieceType_metricvalue;
-		data.timestamp = ev.Timestamp;
-		this->sharedSpin.killSetpieceEvents.push_back(std::move(data));
-	});
-
-	// SA Tracking
-	events.listen<Events::MurderedBodySeen>([this](const ServerEvent<Events::MurderedBodySeen>& ev) {
-		if (ev.Value.IsWitnessTarget) return;
-		this->sharedSpin.voidSA();
-	});
-	events.listen<Events::Spotted>([this](const ServerEvent<Events::Spotted>& ev) {
-		for (auto const& id : ev.Value.value) {
-			if (!this->sharedSpin.killed.contains(id))
-				this->sharedSpin.spottedNotKilled.insert(id);
-		}
-	});
-	events.listen<Events::SecuritySystemRecorder>([this](const ServerEvent<Events::SecuritySystemRecorder>& ev) {
-		switch (ev.Value.event) {
-			case SecuritySystemRecorderEvent::Spotted:
-				if (this->sharedSpin.isCamsDestroyed) return;
-				this->sharedSpin.isCaughtOnCams = true;
-				break;
-			case SecuritySystemRecorderEvent::Destroyed:
-				this->sharedSpin.isCamsDestroyed = true;
-				this->sharedSpin.isCaughtOnCams = false;
-				break;
-			case SecuritySystemRecorderEvent::Erased:
-				this->sharedSpin.isCaughtOnCams = false;
-				break;
-		}
+	// The actors are recreated by a load.
+	events.listen<Events::ContractLoad>([this](const ServerEvent<Events::ContractLoad>& ev) {
+		this->targetActorsDirty = true;
 	});
 }
 
-auto Croupier::ValidateKillMethod(eTargetID target, const ServerEvent<Events::Kill>& ev, eKillMethod method, eKillType type) -> eKillValidationType {
-	auto const killType = ev.Value.KillType;
-	auto const& killClass = ev.Value.KillClass;
-	auto const& killMethodBroad = ev.Value.KillMethodBroad;
-	auto const& killMethodStrict = ev.Value.KillMethodStrict;
-	auto const killContext = ev.Value.KillContext;
-	auto const haveKillItem = !ev.Value.KillItemRepositoryId.empty();
-	auto const isKillClassUnknown = killClass == "unknown";
-	auto const isSilencedWeapon = ev.Value.WeaponSilenced;
-	auto const isAccident = ev.Value.Accident;
-	auto const isExplosive = ev.Value.Explosive;
-	auto const isSniper = ev.Value.Sniper;
-	auto const isProjectile = ev.Value.Projectile;
-	auto const haveKillMethod = !ev.Value.KillMethodBroad.empty() || !ev.Value.KillMethodStrict.empty();
-	auto const haveDamageEvents = !ev.Value.DamageEvents.empty();
-
-	if (target == eTargetID::SierraKnox) {
-		// If expecting injected poison, determine whether the proxy medic opportunity was used
-		if (method == eKillMethod::InjectedPoison
-			&& killContext == EDeathContext::eDC_ACCIDENT
-			&& killClass == "poison"
-			&& killMethodStrict == "")
-			// EKillType_ItemTakeOutFront (4)
-			return eKillValidationType::Valid;
-
-		// true for car kill
-		// EKillType_ItemTakeOutFront (4)
-		// KillClass == "unknown"
-		// killContext == eDC_HIDDEN (2)
-		// KillMethodBroad == ""
-		// KillMethodStrict == ""
-		auto const isContextKill = haveDamageEvents && ev.Value.DamageEvents[0] == "ContextKill";
-		if (method == eKillMethod::Explosion
-			&& isContextKill
-			&& isKillClassUnknown
-			&& killContext == EDeathContext::eDC_HIDDEN)
-			return eKillValidationType::Valid;
-	}
-
-	if (type == eKillType::Silenced && !isSilencedWeapon)
-		return eKillValidationType::Invalid;
-	if (type == eKillType::Loud && isSilencedWeapon)
-		return eKillValidationType::Invalid;
-
-	// ev.Value.KillMethodBroad == "close_combat_pistol_elimination"
-	switch (method) {
-	case eKillMethod::NeckSnap:
-		return killMethodBroad == "unarmed" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Pistol:
-		return killMethodBroad == "pistol" || killMethodBroad == "close_combat_pistol_elimination" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::PistolElimination:
-		return killMethodBroad == "close_combat_pistol_elimination" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::SMG:
-		if (killMethodBroad == "melee_lethal" && ev.Value.KillItemCategory == "smg") // wtf?
-			return eKillValidationType::Valid;
-		return killMethodBroad == "smg" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::SMGElimination:
-		return killMethodBroad == "melee_lethal" && ev.Value.KillItemCategory == "smg" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Shotgun:
-		return killMethodBroad == "shotgun" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::AssaultRifle:
-		return killMethodBroad == "assaultrifle" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Sniper:
-		return killMethodBroad == "sniperrifle" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Explosive:
-		if (type == eKillType::Any || type == eKillType::Loud || type == eKillType::Impact) {
-			// Check for molotov burn kills...
-			if (haveDamageEvents
-				&& ev.Value.DamageEvents[0] == "Burn"
-				&& !haveKillMethod
-				&& !isAccident)
-				return eKillValidationType::Valid;
-		}
-		if (type == eKillType::Any || type == eKillType::Loud || type == eKillType::Impact) {
-			// Check for deadly lock-on throw kills...
-			if (killMethodBroad == "throw"
-				&& killClass == "melee"
-				&& checkExplosiveKillType(ev.Value.KillItemRepositoryId, type))
-				return eKillValidationType::Valid;
-		}
-		return killMethodBroad == "explosive"
-			&& checkExplosiveKillType(ev.Value.KillItemRepositoryId, type)
-			? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::FiberWire:
-		return killMethodBroad == "fiberwire" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::InjectedPoison:
-		// Validate ambiguous poisons that aren't "consumed" - includes medic proxy injected opportunity for Sierra Knox
-		if (killClass == "poison"
-			&& killMethodStrict == "")
-			// EKillType_ItemTakeOutFront (4)
-			return eKillValidationType::Valid;
-		return killMethodStrict == "injected_poison" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::ConsumedPoison:
-		// killItemCategory = poison
-		// killItemRepoId = id of poison item
-		// Validate ambiguous poisons that aren't "injected"
-		if (killClass == "poison"
-			&& killMethodStrict == "")
-			// EKillType_ItemTakeOutFront (4)
-			return eKillValidationType::Valid;
-		return killMethodStrict == "consumed_poison" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Drowning:
-		// ev.Value.KillMethodBroad == "accident"
-		return killMethodStrict == "accident_drown" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Explosion:
-		return killMethodStrict == "accident_explosion" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Fall:
-		// If expecting fall kill and the cause of death is mysterious, we can assume it's correct based on some OOB kill indicators
-		if (killContext == EDeathContext::eDC_MURDER
-			&& killType == EKillType::EKillType_ItemTakeOutFront
-			&& isKillClassUnknown
-			&& !haveKillMethod
-			&& !haveDamageEvents
-			&& !haveKillItem)
-			return eKillValidationType::Valid;
-
-		return killMethodStrict == "accident_push" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::FallingObject:
-		// Special cases: sometimes (possibly for challenge reasons?) the game reports no specific kill method,
-		// but does report a setpiece repository ID of the falling object. Check for one of these objects...
-		if (killMethodStrict == "") {
-			// Only one proven to present this issue, specifically on Wazir Kale (and the FO by the lead actor's puke spot)
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
-			if (ev.Value.SetPieceId == "701a4dfc-fb62-4702-ac1d-a07188851642")
-				return eKillValidationType::Valid;
-
-			// But because of it we need to check every single one...
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_02
-			if (ev.Value.SetPieceId == "52837b63-b731-45e5-b220-d6680ac5eb16")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
-			if (ev.Value.SetPieceId == "d785c660-6b7a-4804-979b-34921b75c138")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_08
-			if (ev.Value.SetPieceId == "4b19effc-09ae-476c-9124-c811a0f82d51")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_03
-			if (ev.Value.SetPieceId == "9c94f9ed-6083-4c4e-94a3-067dce5db327")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D
-			if (ev.Value.SetPieceId == "3d937afc-e4c2-432f-b852-0daf0f73c855")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_01
-			if (ev.Value.SetPieceId == "8e474ae0-699f-44b5-8343-d09eadc9a8af")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
-			if (ev.Value.SetPieceId == "f97e7a1d-f188-4bb5-a46d-bc97505c667f")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
-			if (ev.Value.SetPieceId == "82864825-624e-40a4-9b17-0d51a7aa663d")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_05
-			if (ev.Value.SetPieceId == "205dfccf-c187-4867-890e-0a3f3856ed09")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_06
-			if (ev.Value.SetPieceId == "ed5d28f9-70b7-4460-b0db-8d1e0f3970e4")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_04
-			if (ev.Value.SetPieceId == "46d62cd5-6b7a-4ef1-b284-2e06391197d3")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_06
-			if (ev.Value.SetPieceId == "379402c3-0f48-440a-bb0c-e6d70ae16e77")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
-			if (ev.Value.SetPieceId == "1d5c45af-ef8a-45f2-aab2-262e337f2584")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
-			if (ev.Value.SetPieceId == "27ad6d30-1587-4411-8507-17c19b311c9e")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_04
-			if (ev.Value.SetPieceId == "3bf4a4c5-be0a-423a-b34b-fe29602ac499")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
-			if (ev.Value.SetPieceId == "e237df91-9ea7-4c96-b711-d29d11b70a73")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
-			if (ev.Value.SetPieceId == "d0eb2ff6-d95a-48b5-816c-394cadc7e3e5")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
-			if (ev.Value.SetPieceId == "6ea6dc37-beb1-465c-aa67-706be152b137")
-				return eKillValidationType::Valid;
-			// SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
-			if (ev.Value.SetPieceId == "98be2403-5d97-4eea-840f-876adaa098c4")
-				return eKillValidationType::Valid;
-		}
-		return killMethodStrict == "accident_suspended_object" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Fire:
-		{
-			// Validate incinerator fire kills (this may also pass for garden shredder kills)
-			auto fireSetpieceEv = this->sharedSpin.getSetpieceEventAtTimestamp(ev.Timestamp);
-			if (killMethodStrict == ""
-				&& killType == EKillType::EKillType_ItemTakeOutFront
-				&& isKillClassUnknown
-				&& !haveKillMethod
-				&& !haveKillItem
-				&& !ev.Value.DamageEvents.empty()
-				&& std::find(ev.Value.DamageEvents.cbegin(), ev.Value.DamageEvents.cend(), "InCloset") != ev.Value.DamageEvents.cend()
-				&& fireSetpieceEv
-				&& isIncineratorSetpiece(fireSetpieceEv->id)
-				&& fireSetpieceEv->name == "BodyFlushed")
-				return eKillValidationType::Valid;
-		}
-		// Handle typical fire kills.
-		return killMethodStrict == "accident_burn" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	case eKillMethod::Electrocution:
-		return killMethodStrict == "accident_electric" ? eKillValidationType::Valid : eKillValidationType::Invalid;
-	}
-	return eKillValidationType::Unknown;
-}
-
-auto Croupier::ValidateKillMethod(eTargetID target, const ServerEvent<Events::Kill>& ev, eMapKillMethod method, eKillType type) -> eKillValidationType {
-	if (target == eTargetID::SilvioCaruso) {
-		// {"Timestamp":173.116608,"Name":"Kill","ContractSessionId":"2516591008337813079-9ea716b6-6798-4687-ba22-3bb8d89cce9b","ContractId":"00000000-0000-0000-0000-000000000600","Value":{"RepositoryId":"0dfaea51-3c36-4722-9eff-f1e7ef139878","ActorId":2739847461.000000,"ActorName":"Silvio Caruso","ActorType":0.000000,"KillType":4.000000,"KillContext":3.000000,"KillClass":"unknown","Accident":true,"WeaponSilenced":false,"Explosive":false,"ExplosionType":0.000000,"Projectile":false,"Sniper":false,"IsHeadshot":false,"IsTarget":true,"ThroughWall":false,"BodyPartId":-1.000000,"TotalDamage":100000.000000,"IsMoving":false,"RoomId":182.000000,"ActorPosition":"-105.703, -175.75, -0.775244","HeroPosition":"-110.366, -119.28, 16.0837","DamageEvents":[],"PlayerId":4294967295.000000,"OutfitRepositoryId":"fd56a934-f402-4b52-bdca-8bbc737400ff","OutfitIsHitmanSuit":false,"EvergreenRarity":-1.000000,"KillMethodBroad":"","KillMethodStrict":"","IsReplicated":true,"History":[]},"UserId":"b1585b4d-36f0-48a0-8ffa-1b72f01759da","SessionId":"61e82efa0bcb4a3088825dd75e115f61-468215834","Origin":"gameclient","Id":"c5d04012-68a1-473a-8769-3a0c3b9da097"}
-		if (method == eMapKillMethod::Silvio_SeaPlane) {
-			// Best we can really do is just check Silvio ever entered the plane
-			// and the kill was an accident (it is possible to kill him directly with explosive while he is in the plane).
-			auto lse = this->sharedSpin.getLevelSetupEventByEvent("Silvio_InPlane");
-			return lse != nullptr && ev.Value.Accident
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-		if (method == eMapKillMethod::Silvio_ShootThroughTelescope) {
-			return ev.Value.SetPieceId == "a84ba351-285a-4f07-8758-2d7640401aad"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::JordanCross) {
-		if (method == eMapKillMethod::Jordan_CakeSmother) {
-			return ev.Value.SetPieceId == "be8452d0-3ce9-4f41-b1c2-a381d7e95e15"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::SeanRose) {
-		if (method == eMapKillMethod::Sean_ExplosiveWatchBattery) {
-			return ev.Value.SetPieceId == "66d7a0d3-7ee8-4065-9475-8765fca06faa"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::YukiYamazaki) {
-		if (method == eMapKillMethod::Yuki_Sauna) {
-			return ev.Value.SetPieceId == "9477e941-880c-4b05-932f-d431eaeb634e"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-		if (method == eMapKillMethod::Yuki_SabotageCableCar) {
-			auto lse = this->sharedSpin.getLevelSetupEventByEvent("Cablecar_Down");
-			return lse != nullptr
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-
-		// Yoga: 40237d59-f3c8-46a7-9760-49eac05315d6
-	}
-	if (target == eTargetID::RobertKnox) {
-		// Push On Track: b6d26119-db90-4224-b50a-dcb04c3e159d
-	}
-	if (target == eTargetID::SierraKnox) {
-		auto const haveDamageEvents = !ev.Value.DamageEvents.empty();
-		auto const killContext = ev.Value.KillContext;
-		auto const& killClass = ev.Value.KillClass;
-		auto const& killMethodStrict = ev.Value.KillMethodStrict;
-		auto const isKillClassUnknown = killClass == "unknown";
-		// If expecting injected poison, determine whether the proxy medic opportunity was used
-		if (method == eMapKillMethod::Sierra_PoisonIVDrip) {
-			return killContext == EDeathContext::eDC_ACCIDENT
-				&& killClass == "poison"
-				&& killMethodStrict == ""
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-		// true for car kill
-		// EKillType_ItemTakeOutFront (4)
-		// KillClass == "unknown"
-		// killContext == eDC_HIDDEN (2)
-		// KillMethodBroad == ""
-		// KillMethodStrict == ""
-		auto const isContextKill = haveDamageEvents && ev.Value.DamageEvents[0] == "ContextKill";
-		if ((method == eMapKillMethod::Sierra_BombCar || method == eMapKillMethod::Sierra_ShootCar)
-			&& isContextKill
-			&& isKillClassUnknown
-			&& killContext == EDeathContext::eDC_HIDDEN)
-			return eKillValidationType::Valid;
-	}
-	if (target == eTargetID::RicoDelgado) {
-		if (method == eMapKillMethod::Rico_FeedToHippo) {
-			// Method should already be validated by a separate event for dumping into enclosure.
-			// The following is specifically for the context kill push with cutscene.
-			return ev.Value.SetPieceId == "41f35d49-c74a-4de2-8119-d11cfef0b408"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::JorgeFranco) {
-		if (method == eMapKillMethod::Jorge_CocaineMachine) {
-			// Context kill with cutscene.
-			if (ev.Value.SetPieceId == "803b6461-0c4c-4f3d-9d6a-d9219a9d3136")
-				return eKillValidationType::Valid;
-			// For KO and dump, it should be sufficient to check the kill happened inside a container.
-			auto const it = std::find(ev.Value.DamageEvents.cbegin(), ev.Value.DamageEvents.cend(), "InCloset");
-			return it != ev.Value.DamageEvents.cend()
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-		//if (method == eMapKillMethod::RarePlant) {
-		//	return ev.Value.SetPieceId == "eff668ff-341b-4a9d-850f-14c3b05bb1f7"
-		//		? eKillValidationType::Valid
-		//		: eKillValidationType::Invalid;
-		//}
-	}
-	if (target == eTargetID::VanyaShah) {
-		if (method == eMapKillMethod::Vanya_SteamPool) {
-			return ev.Value.SetPieceId == "36744d6c-77e9-429a-98d6-8cfc1b93454f"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::AndreaMartinez) {
-		//if (method == eMapKillMethod::PiranhaFood) {
-		//	return ev.Value.SetPieceId == "7e9e7387-8c6a-4782-bb2a-cfc7c3574895"
-		//		? eKillValidationType::Valid
-		//		: eKillValidationType::Invalid;
-		//}
-	}
-	if (target == eTargetID::Janus) {
-		if (method == eMapKillMethod::Janus_Sculpture) {
-			return ev.Value.SetPieceId == "2258f06a-76d0-49a1-ba01-b34d894760bf"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::AthenaSavalas) {
-		if (method == eMapKillMethod::Athena_Award) {
-			// setpiece_raccoon_unique.template -> SetpieceHelpers_ContextKill_CustomSequence2
-			return ev.Value.SetPieceId == "1a29d28c-be03-4149-b49c-b0c38d060772"
-				? eKillValidationType::Valid
-				: eKillValidationType::Invalid;
-		}
-	}
-	if (target == eTargetID::StevenBradley) {
-		if (method == eMapKillMethod::Steven_BombWaterScooter) {
-			// 'Legit' water scooter kill
-			// setpiece_stingray_unique.template -> Setpiece_Trap_WaterScooterRide
-			if (ev.Value.SetPieceId == "0bd4c163-9674-403a-aa3d-a714be3d7a09")
-				return eKillValidationType::Valid;
-			// Accident explosion via water scooter
-			// Technically this can validate even if Steven is killed in an unrelated accident explosion and the scooter
-			// also gets blown up around the same time, but fuck it
-			auto const setpiece = this->sharedSpin.getSetpieceEventAtTimestamp(ev.Timestamp, 0.3);
-			return setpiece != nullptr && setpiece->id == "2f4a7b8f-a5f1-4c59-8a0e-678b3c2ee32f"
-				? ValidateKillMethod(target, ev, eKillMethod::Explosion, type)
-				: eKillValidationType::Invalid;
-		}
-	}
-
-	if (!ev.Value.KillItemRepositoryId.empty()) {
-		if (type == eKillType::Thrown && ev.Value.KillMethodBroad != "throw") {
-			Logger::Info("Kill validation failed. Expected 'throw', got '{}'.", ev.Value.KillMethodBroad);
-			Logger::Info("{}", ev.json.dump());
-			return eKillValidationType::Invalid;
-		}
-		if (type == eKillType::Melee && ev.Value.KillMethodBroad != "melee_lethal") {
-			Logger::Info("Kill validation failed. Expected 'melee_lethal', got '{}'.", ev.Value.KillMethodBroad);
-			Logger::Info("{}", ev.json.dump());
-			return eKillValidationType::Invalid;
-		}
-
-		auto it = specificKillMethodsByRepoId.find(ev.Value.KillItemRepositoryId);
-		if (it != end(specificKillMethodsByRepoId) && it->second == method) {
-			return eKillValidationType::Valid;
-		}
-
-		if (it == end(specificKillMethodsByRepoId))
-			Logger::Info("Invalid kill '{}'. Repo ID unknown.", ev.Value.KillItemRepositoryId);
-		else
-			Logger::Info("Invalid kill '{}'. Repo ID kill method mismatch (expected {}, got {}).", ev.Value.KillItemRepositoryId, static_cast<int>(method), static_cast<int>(it->second));
-		Logger::Info("{}", ev.json.dump());
-	}
-	return eKillValidationType::Invalid;
-}
-
 DEFINE_PLUGIN_DETOUR(Croupier, void*, OnLoadingScreenActivated, void* th, void* a1) {
-	loadingScreenActivated = true;
-	if (!loadRemovalActive) {
-		SendLoadStarted();
-		loadRemovalActive = true;
-	}
+	this->UpdateState([this] {
+		this->loadingScreenActivated = true;
+		if (!this->loadRemovalActive) {
+			this->SendLoadStarted();
+			this->loadRemovalActive = true;
+		}
+	});
 	return HookResult<void*>(HookAction::Continue());
 }
 
@@ -2206,47 +1568,14 @@ DEFINE_PLUGIN_DETOUR(Croupier, void, OnEventReceived, ZAchievementManagerSimple*
 	return HookResult<void>(HookAction::Continue());
 }
 
-// Wrapper for Functions::ZDynamicObject_ToString that attempts to prevent invalid JSON output.
-static auto ZDynamicObjectToString(ZDynamicObject& obj) -> ZString {
-	// Handle the main object structure so we can invoke ourselves for individual entries.
-	if (obj.Is<TArray<SDynamicObjectKeyValuePair>>()) {
-		auto arr = obj.As<TArray<SDynamicObjectKeyValuePair>>();
-		auto first = true;
-		auto str = std::ostringstream();
-		str << "{";
-
-		for (auto& entry : *arr) {
-			if (!first) str << ",";
-			first = false;
-
-			auto objStr = ZDynamicObjectToString(entry.value);
-
-			// Key should never contain quotes but we'll do quoted to be on the safe side + it's neater.
-			str << std::quoted(entry.sKey.c_str()) << ":" << objStr.c_str();
-		}
-
-		str << "}";
-		return ZString(str.str());
-	}
-
-	if (obj.Is<ZString>()) {
-		// Remove null terminator from strings.
-		auto res = obj.As<ZString>();
-		auto resSV = std::string_view(res->c_str(), res->size());
-		auto fixedStr = std::string(resSV.size(), '\0');
-		std::remove_copy(resSV.cbegin(), resSV.cend(), fixedStr.begin(), '\n');
-
-		// Quote the string.
-		return (std::ostringstream() << std::quoted(fixedStr.c_str())).str();
-	}
-
-	// Use the game method for anything we don't need to handle.
-	ZString res;
-	Functions::ZDynamicObject_ToString->Call(const_cast<ZDynamicObject*>(&obj), &res);
-	return res;
+// Writes an event's MessagePack out as JSON text, reusing the capacity of `text`.
+static auto eventToString(std::span<const uint8_t> payload, std::string& text) -> bool {
+	text.clear();
+	JsonTextWriter writer(text);
+	return visitMessagePack(payload, writer);
 }
 
-static std::set<std::string> eventsNotToPrint = {
+static const std::unordered_set<std::string_view> eventsNotToPrint = {
 	// Map-specific Perma Shortcut Events
 	"Bulldog_Ladder_A_Open",
 	"Bulldog_Ladder_B_Open",
@@ -2394,27 +1723,114 @@ static std::set<std::string> eventsNotToPrint = {
 };
 
 DEFINE_PLUGIN_DETOUR(Croupier, void, OnEventSent, ZAchievementManagerSimple* th, uint32_t eventIndex, const ZDynamicObject& ev) {
-	ZString eventData = ZDynamicObjectToString(const_cast<ZDynamicObject&>(ev));
-
-	try {
-		auto json = nlohmann::json::parse(eventData.c_str(), eventData.c_str() + eventData.size());
-		auto const eventName = json.value("Name", "");
-		auto const dontPrint = eventsNotToPrint.contains(eventName);
-
-		if (!dontPrint)
-			Logger::Info("Croupier: event {}", eventData);
-
-		this->events.handle(eventName, json);
+	// Most events are neither listened to nor logged, so check the name before decoding anything.
+	auto const eventName = findDynamicObjectString(ev, "Name");
+	auto const eventId = getEventByName(eventName);
+	auto const dontPrint = eventsNotToPrint.contains(eventName);
+	auto const dispatch = eventId && this->events.hasListeners(*eventId);
+	auto const record = this->recordingEvents.load();
+	// The first event after a load is always passed on, as the spin is rewound to the save by its time.
+	auto const afterLoad = this->awaitingEventAfterLoad && eventId != Events::ContractLoad;
+	if (eventId == Events::ContractLoad) this->awaitingEventAfterLoad = true;
+	else if (afterLoad) this->awaitingEventAfterLoad = false;
+	if (dontPrint && !dispatch && !record && !afterLoad)
+		return HookResult<void>(HookAction::Continue());
+
+	// The game's object only lives for this call, so it's encoded into a queue slot here and everything else happens on
+	// the event worker. Waiting for a slot could stall the game for as long as the worker is held up, so when the queue
+	// is full the event is dropped and counted instead.
+	auto slot = this->eventQueue.back();
+	if (!slot) {
+		++this->droppedEvents;
+		return HookResult<void>(HookAction::Continue());
 	}
-	catch (const nlohmann::json::exception& ex) {
-		Logger::Info("Error handling event: {}", eventData);
-		Logger::Error("{}", eventData);
-		Logger::Error("JSON exception: {}", ex.what());
+
+	slot->id = eventId.value_or(Events{});
+	slot->dispatch = dispatch;
+	slot->afterLoad = afterLoad;
+	slot->print = !dontPrint;
+	slot->record = record;
+	slot->timestamp = findDynamicObjectNumber(ev, "Timestamp");
+	slot->name.assign(eventName);
+	slot->payload.clear();
+
+	MessagePackWriter writer(slot->payload);
+	if (!visitDynamicObject(ev, writer)) {
+		Logger::Error("Croupier: could not decode event {}", eventName);
+		return HookResult<void>(HookAction::Continue());
 	}
+	this->eventQueue.push();
 
 	return HookResult<void>(HookAction::Continue());
 }
 
+auto Croupier::StartEventWorker() -> void {
+	if (this->eventWorkerRunning) return;
+	this->eventWorkerRunning = true;
+	this->eventThread = std::thread([this] { this->ProcessEvents(); });
+}
+
+auto Croupier::StopEventWorker() -> void {
+	if (!this->eventWorkerRunning) return;
+	this->eventWorkerRunning = false;
+
+	// The hooks are gone by now, so this thread can stand in as the producer to wake the worker with an empty event.
+	QueuedEvent* slot;
+	while (!(slot = this->eventQueue.back()))
+		std::this_thread::yield();
+	slot->dispatch = slot->afterLoad = slot->print = slot->record = false;
+	this->eventQueue.push();
+
+	this->eventThread.join();
+}
+
+auto Croupier::ProcessEvents() -> void {
+	// Kept across events so printing them doesn't allocate once it's grown to fit.
+	std::string eventText;
+
+	for (;;) {
+		if (auto dropped = this->droppedEvents.exchange(0))
+			Logger::Warn("Croupier: dropped {} events, the event queue was full", dropped);
+
+		// Drain whatever is left before stopping.
+		auto event = this->eventQueue.front();
+		if (!event) {
+			if (!this->eventWorkerRunning) break;
+			this->eventQueue.wait();
+			continue;
+		}
+
+		// Everything reads the MessagePack encoded on the game thread, nothing builds a DOM of it.
+		auto const payload = std::span<const uint8_t>(event->payload);
+
+		// One bad event mustn't end the worker, which would take the game down with it.
+		try {
+			if (event->record)
+				this->eventLog.write(event->name, event->timestamp, payload);
+
+			if (event->print) {
+				if (eventToString(payload, eventText)) Logger::Info("Croupier: event {}", eventText);
+				else Logger::Error("Croupier: could not decode event {}", event->name);
+			}
+
+			if (event->dispatch || event->afterLoad) {
+				this->UpdateState([&] {
+					this->sharedSpin.seeEvent(event->timestamp);
+					if (event->dispatch) this->events.handle(event->id, payload, &this->eventArena);
+					this->spinSnapshotDirty = true;
+				});
+			}
+		}
+		catch (const std::exception& ex) {
+			Logger::Error("Croupier: error handling event {}: {}", event->name, ex.what());
+		}
+
+		// Nothing decoded from the event outlives its handlers.
+		this->eventArena.release();
+		this->eventQueue.pop();
+	}
+}
+
 DEFINE_PLUGIN_DETOUR(Croupier, void, OnWinHttpCallback, void* dwContext, void* hInternet, void* param_3, int dwInternetStatus, void* param_5, int param_6) {
 	static wchar_t buffer[200];
 	DWORD size = sizeof(buffer);
@@ -2438,10 +1854,14 @@ DEFINE_PLUGIN_DETOUR(Croupier, void, OnWinHttpCallback, void* dwContext, void* h
 					auto contractId = rest.substr(0, rest.find_first_of('&'));
 					auto mission = getMissionByContractId(std::string(contractId));
 
+					// This runs on a WinHTTP thread, not the game thread.
 					if (mission != eMission::NONE) {
-						this->OnMissionSelect(mission);
-						if (!this->sharedSpin.isPlaying)
-							this->sharedSpin.playerStart();
+						this->UpdateState([this, mission] {
+							this->OnMissionSelect(mission);
+							if (!this->sharedSpin.isPlaying)
+								this->sharedSpin.playerStart();
+							this->spinSnapshotDirty = true;
+						});
 					}
 				}
 			}
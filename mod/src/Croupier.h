@@ -1,20 +1,38 @@
 #pragma once
 #include "CroupierClient.h"
 #include "Events.h"
+#include "EventLog.h"
 #include "EventSystem.h"
+#include "FrameScheduler.h"
 #include "KillConfirmation.h"
+#include "KillValidation.h"
 #include "Roulette.h"
+#include "SharedRouletteSpin.h"
+#include "SpscQueue.h"
 #include <IPluginInterface.h>
 #include <Glacier/Enums.h>
 #include <Glacier/SGameUpdateEvent.h>
 #include <Glacier/SOnlineEvent.h>
+#include <Glacier/ZActor.h>
 #include <Glacier/ZGameUIManager.h>
 #include <Glacier/ZInput.h>
 #include <Glacier/ZObject.h>
 #include <Glacier/ZString.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <filesystem>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <stack>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 enum class DockMode {
 	None,
@@ -24,177 +42,6 @@ enum class DockMode {
 	BottomRight,
 };
 
-struct KillSetpieceEvent {
-	std::string id;
-	std::string name;
-	std::string type;
-	double timestamp;
-};
-
-struct LevelSetupEvent {
-	//std::string contractName;
-	//std::string location;
-	std::string event;
-	double timestamp;
-};
-
-struct SharedRouletteSpin {
-	const RouletteSpin& spin;
-	std::set<std::string, InsensitiveCompareLexicographic> killed;
-	std::set<std::string, InsensitiveCompareLexicographic> spottedNotKilled;
-	std::vector<DisguiseChange> disguiseChanges;
-	std::vector<KillConfirmation> killValidations;
-	std::vector<KillSetpieceEvent> killSetpieceEvents;
-	std::vector<LevelSetupEvent> levelSetupEvents;
-	std::vector<LoadoutItemEventValue> loadout;
-	std::string locationId;
-	std::chrono::steady_clock::time_point timeStarted;
-	std::chrono::seconds timeElapsed = std::chrono::seconds(0);
-	double startIGT = 0;
-	double exitIGT = 0;
-	bool isSA = true;
-	bool isCaughtOnCams = false;
-	bool isCamsDestroyed = false;
-	bool isPlaying = false;
-	bool isFinished = false;
-	bool hasLoadedGame = false;		// current play session is from a loaded game
-	LONG windowX = 0;
-	LONG windowY = 0;
-
-	SharedRouletteSpin(const RouletteSpin& spin) : spin(spin), timeElapsed(0) {
-		timeStarted = std::chrono::steady_clock().now();
-		this->resetKillValidations();
-	}
-
-	auto getTargetKillValidation(eTargetID target) const -> KillConfirmation {
-		//if (hasLoadedGame) return KillConfirmation(target, eKillValidationType::Unknown);
-		for (auto& kc : killValidations) {
-			if (kc.target == target)
-				return kc;
-		}
-		return KillConfirmation(target, eKillValidationType::Incomplete);
-	}
-
-	auto getKillConfirmation(size_t idx) -> KillConfirmation& {
-		if (killValidations.size() < spin.getConditions().size())
-			this->resetKillValidations();
-		if (idx > killValidations.size()) throw std::exception("Invalid kill confirmation index.");
-		return killValidations[idx];
-	}
-
-	auto getLastDisguiseChangeAtTimestamp(float timestamp) const -> const DisguiseChange* {
-		for (auto i = disguiseChanges.size(); i > 0; --i) {
-			if (disguiseChanges[i - 1].timestamp < timestamp)
-				return &disguiseChanges[i - 1];
-		}
-		return nullptr;
-	}
-
-	auto getSetpieceByName(std::string_view name) const -> const KillSetpieceEvent* {
-		for (auto i = killSetpieceEvents.size(); i > 0; --i) {
-			if (killSetpieceEvents[i - 1].name == name)
-				return &killSetpieceEvents[i - 1];
-		}
-		return nullptr;
-	}
-
-	auto getSetpieceEventAtTimestamp(double timestamp, double margin = 0.1) const -> const KillSetpieceEvent* {
-		for (auto i = killSetpieceEvents.size(); i > 0; --i) {
-			if (std::abs(killSetpieceEvents[i - 1].timestamp - timestamp) < margin)
-				return &killSetpieceEvents[i - 1];
-		}
-		return nullptr;
-	}
-
-	auto getLevelSetupEventByEvent(std::string_view name) const -> const LevelSetupEvent* {
-		for (auto i = levelSetupEvents.size(); i > 0; --i) {
-			if (levelSetupEvents[i - 1].event == name)
-				return &levelSetupEvents[i - 1];
-		}
-		return nullptr;
-	}
-
-	auto getLevelSetupEventAtTimestamp(double timestamp, double margin = 0.1) const -> const LevelSetupEvent* {
-		for (auto i = levelSetupEvents.size(); i > 0; --i) {
-			if (std::abs(levelSetupEvents[i - 1].timestamp - timestamp) < margin)
-				return &levelSetupEvents[i - 1];
-		}
-		return nullptr;
-	}
-
-	auto getLastDisguiseChange() const -> const DisguiseChange* {
-		return disguiseChanges.empty() ? nullptr : &disguiseChanges.back();
-	}
-
-	auto getTimeElapsed() const -> std::chrono::seconds {
-		if (!this->isFinished && this->isPlaying) {
-			return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock().now() - timeStarted);
-		}
-		return this->isFinished ? this->timeElapsed : std::chrono::seconds::zero();
-	}
-
-	auto voidSA() {
-		if (this->isFinished) return;
-		this->isSA = false;
-	}
-
-	auto playerSelectMission() {
-		this->isPlaying = false;
-		this->isFinished = false;
-	}
-
-	auto playerStart() {
-		this->resetKillValidations();
-
-		if (!this->isPlaying) {
-			this->isPlaying = true;
-			this->timeStarted = std::chrono::steady_clock().now();
-			this->isFinished = false;
-		}
-
-		this->killed.clear();
-		this->spottedNotKilled.clear();
-		this->exitIGT = 0;
-		this->isSA = true;
-		this->isCaughtOnCams = false;
-		this->isCamsDestroyed = false;
-		this->hasLoadedGame = false;
-	}
-
-	auto playerCutsceneEnd(double igt) {
-		this->startIGT = igt;
-		this->isPlaying = true;
-	}
-
-	auto playerLoad() {
-		this->isPlaying = true;
-		this->hasLoadedGame = true;
-		this->resetKillValidations();
-	}
-
-	auto playerExit(double timestamp = 0) {
-		this->timeElapsed = this->getTimeElapsed();
-		this->isPlaying = false;
-		this->isFinished = true;
-		if (this->spottedNotKilled.size() > 0)
-			this->isSA = false;
-		this->exitIGT = timestamp - this->startIGT;
-		this->isSA = this->isSA && !this->isCaughtOnCams && !this->hasLoadedGame;
-		this->killed.clear();
-		this->spottedNotKilled.clear();
-	}
-
-	auto resetKillValidations() -> void {
-		killValidations.resize(spin.getConditions().size());
-		disguiseChanges.clear();
-		killSetpieceEvents.clear();
-		levelSetupEvents.clear();
-
-		for (auto& kv : killValidations)
-			kv = KillConfirmation {};
-	}
-};
-
 struct SerializedSpin {
 	struct Condition {
 		std::string targetName;
@@ -211,6 +58,7 @@ struct Configuration {
 	int streakCurrent = 0;
 	bool spinOverlay = false;
 	bool overlayKillConfirmations = true;
+	bool recordEvents = false;
 	DockMode overlayDockMode = DockMode::None;
 	RouletteRuleset customRules;
 	eRouletteRuleset ruleset = eRouletteRuleset::Default;
@@ -218,6 +66,33 @@ struct Configuration {
 	std::vector<SerializedSpin> spinHistory;
 };
 
+// What the spin overlay draws, published whenever it changes so the UI thread can draw it without the state lock.
+struct SpinSnapshot {
+	struct Condition {
+		std::string text;
+		KillConfirmation killValidation;
+	};
+
+	std::vector<Condition> conditions;
+	std::chrono::steady_clock::time_point timeStarted;
+	std::chrono::seconds timeElapsed = std::chrono::seconds(0);
+	bool isPlaying = false;
+	bool isFinished = false;
+	bool spinOverlay = false;
+	bool overlayKillConfirmations = true;
+	bool timer = false;
+	bool streak = false;
+	int streakCurrent = 0;
+	DockMode overlayDockMode = DockMode::None;
+
+	// As SharedRouletteSpin::getTimeElapsed at the time of the call.
+	auto getTimeElapsed() const -> std::chrono::seconds {
+		if (!this->isFinished && this->isPlaying)
+			return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - this->timeStarted);
+		return this->isFinished ? this->timeElapsed : std::chrono::seconds::zero();
+	}
+};
+
 class Croupier : public IPluginInterface {
 public:
 	Croupier();
@@ -235,11 +110,15 @@ public:
 	auto DrawCustomRulesetUI(bool focused) -> void;
 	auto DrawEditMissionPoolUI(bool focused) -> void;
 	auto DrawSpinUI(bool focused) -> void;
+	auto DrawSettingsUI(bool focused) -> void;
 	auto Random() -> void;
 	auto Respin(bool isAuto = true) -> void;
 	auto PreviousSpin() -> void;
 	auto LoadConfiguration() -> void;
+	// Saves the configuration on a later frame.
 	auto SaveConfiguration() -> void;
+	// Hands a copy of the configuration to the writer thread, so the file isn't written while holding the state lock.
+	auto WriteConfiguration() -> void;
 	auto SetDefaultMissionPool() -> void;
 	auto SendAutoSpin(eMission = eMission::NONE) -> void;
 	auto SendRespin(eMission = eMission::NONE) -> void;
@@ -262,23 +141,72 @@ public:
 	auto SendSplitTimer() -> void;
 	auto SendLoadStarted() -> void;
 	auto SendLoadFinished() -> void;
+	// Queues a message to be sent to the client once the state lock is released.
+	auto SendClientMessage(eClientMessage type, std::initializer_list<std::string> args = {}) -> void;
 
 	auto InstallHooks() -> void;
 	auto UninstallHooks() -> void;
 	auto ProcessSpinState() -> void;
 	auto ProcessClientMessages() -> void;
-	auto ValidateKillMethod(eTargetID target, const ServerEvent<Events::Kill>& ev, eKillMethod method, eKillType type) -> eKillValidationType;
-	auto ValidateKillMethod(eTargetID target, const ServerEvent<Events::Kill>& ev, eMapKillMethod method, eKillType type) -> eKillValidationType;
 
 private:
+	// Active actor slot of a spin target, for watching it while it's pacified.
+	struct TargetActor {
+		int slot = 0;
+		ZActor* actor = nullptr;
+		size_t condition = 0;
+	};
+
+	// Event encoded on the game thread, waiting for the event worker to log and dispatch it.
+	// Queue slots are reused, so the strings keep their capacity from one event to the next.
+	struct QueuedEvent {
+		Events id = {};
+		bool dispatch = false;
+		// The first event after a ContractLoad, seen by the spin even if nothing listens to it.
+		bool afterLoad = false;
+		bool print = false;
+		bool record = false;
+		double timestamp = 0;
+		std::string name;
+		// The whole event as MessagePack.
+		std::vector<uint8_t> payload;
+	};
+
 	static std::unordered_map<std::string, eMission> MissionContractIds;
 
 	auto LogSpin() -> void;
 	auto SetupEvents() -> void;
+	auto StartEventWorker() -> void;
+	auto StopEventWorker() -> void;
+	auto ProcessEvents() -> void;
+	auto FormatConfiguration() const -> std::string;
+	auto WriteConfigurationFile(const std::string& content) const -> void;
+	auto StartConfigWriter() -> void;
+	auto StopConfigWriter() -> void;
+	auto ProcessConfigWrites() -> void;
 	auto ProcessMissionsMessage(const ClientMessage& message) -> void;
 	auto ProcessSpinDataMessage(const ClientMessage& message) -> void;
 	auto ProcessLoadRemoval() -> void;
+	auto IndexTargetActors() -> void;
+	auto SetupFrameTasks() -> void;
+	auto DrawFrameTaskStats() -> void;
 	auto ParseSpin(std::string_view str) -> std::optional<RouletteSpin>;
+	auto PublishSpinSnapshot() -> void;
+
+	// Runs `func` with the state lock held. Then, if the overlay's snapshot was marked stale, it publishes a new one. Once
+	// the lock is released, it sends the client messages `func` queued.
+	template<typename TFunc>
+	auto UpdateState(TFunc&& func) -> void {
+		std::vector<ClientMessage> outbox;
+		{
+			auto lock = std::unique_lock(this->stateMutex);
+			func();
+			if (this->spinSnapshotDirty) this->PublishSpinSnapshot();
+			outbox.swap(this->clientOutbox);
+		}
+		for (auto& message : outbox)
+			this->client->send(std::move(message));
+	}
 
 	DECLARE_PLUGIN_DETOUR(Croupier, void*, OnZLevelManagerStateCondition, void* th, __int64 a2);
 	DECLARE_PLUGIN_DETOUR(Croupier, void*, OnLoadingScreenActivated, void* th, void* a1);
@@ -292,11 +220,44 @@ private:
 	RouletteRuleset rules;
 	RouletteSpin spin;
 	SharedRouletteSpin sharedSpin;
+	KillValidator killValidator;
+	// Index of the active actors that are spin targets, rebuilt when the actors change or a target is pacified.
+	std::vector<TargetActor> targetActors;
+	int targetActorsIndexedCount = -1;
+	bool targetActorsDirty = true;
 	std::stack<RouletteSpin> spinHistory;
 	eMission currentMission = eMission::NONE;
 	eRouletteRuleset ruleset = eRouletteRuleset::RRWC2023;
 	EventSystem events;
+	SpscQueue<QueuedEvent, 256> eventQueue;
+	// Events the game thread dropped because the queue was full, reported and reset by the worker.
+	std::atomic<uint32_t> droppedEvents = 0;
+	// Game thread only. A ContractLoad was sent and the event after it hasn't been yet.
+	bool awaitingEventAfterLoad = false;
+	std::thread eventThread;
+	std::atomic_bool eventWorkerRunning = false;
+	// Event values are decoded into this on the worker and it's released after each dispatch.
+	// Overflow beyond the buffer goes to the heap until the next release.
+	std::array<std::byte, 64 * 1024> eventArenaBuffer;
+	std::pmr::monotonic_buffer_resource eventArena{this->eventArenaBuffer.data(), this->eventArenaBuffer.size()};
+	EventLogWriter eventLog;
+	std::atomic_bool recordingEvents = false;
+	FrameScheduler frameScheduler;
+	FrameScheduler::TaskId saveConfigurationTask = 0;
+	// Held through UpdateState by every thread that uses the spin state: the event worker while dispatching, the game
+	// thread for its frame tasks and the WinHTTP callback, and the UI thread only while a window that edits the state is open.
+	std::mutex stateMutex;
+	// Messages for the client, queued under the lock and sent after it's released.
+	std::vector<ClientMessage> clientOutbox;
+	std::atomic<std::shared_ptr<const SpinSnapshot>> spinSnapshot;
+	bool spinSnapshotDirty = true;
 	std::fstream file;
+	std::thread configWriterThread;
+	std::mutex configWriteMutex;
+	std::condition_variable configWriteCondition;
+	// Guarded by configWriteMutex. The latest configuration text waiting for the writer thread.
+	std::optional<std::string> pendingConfiguration;
+	bool configWriterRunning = false;
 	std::filesystem::path modulePath;
 	ImVec2 overlaySize = {};
 	int uiMissionSelectIndex = 0;
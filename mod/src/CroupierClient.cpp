@@ -69,6 +69,13 @@ std::map<std::string, eClientMessage> clientMessageTypeMapRev = {
 	{"LoadFinished", eClientMessage::LoadFinished},
 };
 
+ClientMessage::ClientMessage(eClientMessage type, std::initializer_list<std::string> args) : type(type) {
+	for (auto const& arg : args) {
+		if (!this->args.empty()) this->args += '\t';
+		this->args += arg;
+	}
+}
+
 auto ClientMessage::toString() const -> std::string {
 	auto it = clientMessageTypeMap.find(this->type);
 	if (it == end(clientMessageTypeMap)) return "";
@@ -292,11 +299,11 @@ auto CroupierClient::tryTakeMessage(ClientMessage& messageOut) -> bool {
 
 auto CroupierClient::send(eClientMessage type, std::initializer_list<std::string> args) -> void {
 	if (!this->connected) return;
-	ClientMessage message;
-	message.type = type;
-	std::string argStr;
-	for (auto const& arg : args)
-		argStr += (argStr.empty() ? "" : "\t") + arg;
-	message.args = std::move(argStr);
+	this->send(ClientMessage(type, args));
+}
+
+auto CroupierClient::send(ClientMessage message) -> void {
+	if (!this->connected) return;
+	auto lock = std::unique_lock(this->queueMutex);
 	this->queue.push_back(std::move(message));
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <atomic>
 #include <deque>
+#include <initializer_list>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -39,6 +40,10 @@ enum class eClientMessage {
 
 class ClientMessage {
 public:
+	ClientMessage() = default;
+	// Arguments are joined with tabs.
+	ClientMessage(eClientMessage type, std::initializer_list<std::string> args);
+
 	auto toString() const -> std::string;
 
 	eClientMessage type;
@@ -55,6 +60,7 @@ public:
 	auto abort() -> void;
 	auto isConnected() const -> bool { return this->connected; }
 	auto send(eClientMessage type, std::initializer_list<std::string> args = {}) -> void;
+	auto send(ClientMessage message) -> void;
 	auto tryTakeMessage(ClientMessage&) -> bool;
 
 protected:
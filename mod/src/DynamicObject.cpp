@@ -0,0 +1,37 @@
+#include "DynamicObject.h"
+#include <Functions.h>
+#include <string_view>
+
+auto dynamicObjectStringView(const ZString& str) -> std::string_view {
+	auto sv = std::string_view(str.c_str(), str.size());
+	return sv.substr(0, sv.find('\0'));
+}
+
+auto findDynamicObjectValue(const ZDynamicObject& obj, std::string_view key) -> const ZDynamicObject* {
+	auto& object = const_cast<ZDynamicObject&>(obj);
+	if (!object.Is<TArray<SDynamicObjectKeyValuePair>>()) return nullptr;
+
+	for (auto& entry : *object.As<TArray<SDynamicObjectKeyValuePair>>()) {
+		if (dynamicObjectStringView(entry.sKey) == key)
+			return &entry.value;
+	}
+	return nullptr;
+}
+
+auto findDynamicObjectString(const ZDynamicObject& obj, std::string_view key) -> std::string_view {
+	auto value = const_cast<ZDynamicObject*>(findDynamicObjectValue(obj, key));
+	if (!value || !value->Is<ZString>()) return {};
+	return dynamicObjectStringView(*value->As<ZString>());
+}
+
+auto findDynamicObjectNumber(const ZDynamicObject& obj, std::string_view key, double fallback) -> double {
+	auto value = const_cast<ZDynamicObject*>(findDynamicObjectValue(obj, key));
+	if (!value || !value->Is<float64>()) return fallback;
+	return *value->As<float64>();
+}
+
+auto dynamicObjectGameString(const ZDynamicObject& obj) -> std::string {
+	ZString str;
+	Functions::ZDynamicObject_ToString->Call(const_cast<ZDynamicObject*>(&obj), &str);
+	return dynamicObjectString(str);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <Glacier/ZObject.h>
+#include <Glacier/ZPrimitives.h>
+#include <Glacier/ZString.h>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "json.hpp"
+
+// Receives the contents of a ZDynamicObject in document order. This is the shape of nlohmann::json's SAX interface,
+// so the same visitors can read game objects and JSON text alike. Each call returns false to stop the walk.
+template<typename T>
+concept DynamicObjectVisitor = requires(T& visitor, std::string& str, double d, int64_t i, uint64_t u, size_t n) {
+	{ visitor.null() } -> std::convertible_to<bool>;
+	{ visitor.boolean(true) } -> std::convertible_to<bool>;
+	{ visitor.number_integer(i) } -> std::convertible_to<bool>;
+	{ visitor.number_unsigned(u) } -> std::convertible_to<bool>;
+	{ visitor.number_float(d, str) } -> std::convertible_to<bool>;
+	{ visitor.string(str) } -> std::convertible_to<bool>;
+	{ visitor.key(str) } -> std::convertible_to<bool>;
+	{ visitor.start_object(n) } -> std::convertible_to<bool>;
+	{ visitor.end_object() } -> std::convertible_to<bool>;
+	{ visitor.start_array(n) } -> std::convertible_to<bool>;
+	{ visitor.end_array() } -> std::convertible_to<bool>;
+};
+
+// Views a game string, excluding the null terminator some of them carry.
+auto dynamicObjectStringView(const ZString& str) -> std::string_view;
+
+// Copies a game string, excluding the null terminator some of them carry.
+inline auto dynamicObjectString(const ZString& str) -> std::string {
+	return std::string(dynamicObjectStringView(str));
+}
+
+// Finds the value of a key in an object without visiting anything else. Returns null if `obj` isn't an object or
+// doesn't have the key.
+auto findDynamicObjectValue(const ZDynamicObject& obj, std::string_view key) -> const ZDynamicObject*;
+
+// Views the string value of a key in an object, empty if there's no such key or its value isn't a string.
+auto findDynamicObjectString(const ZDynamicObject& obj, std::string_view key) -> std::string_view;
+
+// The number value of a key in an object, or `fallback` if there's no such key or its value isn't a number.
+auto findDynamicObjectNumber(const ZDynamicObject& obj, std::string_view key, double fallback = 0) -> double;
+
+// Serialises an object with the game's own ZDynamicObject_ToString.
+auto dynamicObjectGameString(const ZDynamicObject& obj) -> std::string;
+
+// Walks a dynamic object into the visitor without producing any intermediate text.
+// Returns false if the visitor stopped the walk early or a value the game serialised couldn't be parsed, in which case
+// the visitor has only seen part of the object and what it built shouldn't be used.
+template<DynamicObjectVisitor TVisitor>
+auto visitDynamicObject(const ZDynamicObject& obj, TVisitor& visitor) -> bool {
+	auto& object = const_cast<ZDynamicObject&>(obj);
+
+	// Keys and strings are handed over in buffers kept per thread, so visiting doesn't allocate for them once they've
+	// grown to fit. Visitors are done with each one before the walk moves on.
+	thread_local std::string scratch;
+
+	if (object.Is<TArray<SDynamicObjectKeyValuePair>>()) {
+		auto entries = object.As<TArray<SDynamicObjectKeyValuePair>>();
+		if (!visitor.start_object(entries->size())) return false;
+
+		for (auto& entry : *entries) {
+			scratch.assign(dynamicObjectStringView(entry.sKey));
+			if (!visitor.key(scratch)) return false;
+			if (!visitDynamicObject(entry.value, visitor)) return false;
+		}
+
+		return visitor.end_object();
+	}
+
+	if (object.Is<TArray<ZDynamicObject>>()) {
+		auto elements = object.As<TArray<ZDynamicObject>>();
+		if (!visitor.start_array(elements->size())) return false;
+
+		for (auto& element : *elements) {
+			if (!visitDynamicObject(element, visitor)) return false;
+		}
+
+		return visitor.end_array();
+	}
+
+	if (object.Is<ZString>()) {
+		scratch.assign(dynamicObjectStringView(*object.As<ZString>()));
+		return visitor.string(scratch);
+	}
+
+	if (object.Is<float64>()) {
+		// The game only has doubles. Whole numbers are reported as integers, as they would be when read from JSON text.
+		constexpr auto maxExactInteger = 9007199254740992.0;
+		auto value = *object.As<float64>();
+		if (std::trunc(value) == value && std::abs(value) <= maxExactInteger) {
+			if (value >= 0) return visitor.number_unsigned(static_cast<uint64_t>(value));
+			return visitor.number_integer(static_cast<int64_t>(value));
+		}
+		if (!std::isfinite(value)) return visitor.null();
+		scratch.clear();
+		return visitor.number_float(value, scratch);
+	}
+
+	if (object.Is<bool>())
+		return visitor.boolean(*object.As<bool>());
+
+	// Anything else is rare enough to go through the game's own serialisation.
+	auto text = dynamicObjectGameString(object);
+	return nlohmann::json::sax_parse(text, &visitor, nlohmann::json::input_format_t::json, false);
+}
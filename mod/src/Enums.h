@@ -1,8 +1,11 @@
 #pragma once
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <Glacier/Enums.h>
+#include "KeywordTable.h"
 
 enum class MissionType {
 	Arcade,
@@ -79,6 +82,9 @@ enum class Events {
 	Witnesses,
 };
 
+// Events are dense from zero, keep Witnesses (or whatever replaces it) last.
+constexpr auto numEvents = static_cast<size_t>(Events::Witnesses) + 1;
+
 enum class SecuritySystemRecorderEvent {
 	Undefined,
 	Spotted,
@@ -95,6 +101,147 @@ inline auto getSecuritySystemRecorderEventFromString(const std::string& str) {
 	return SecuritySystemRecorderEvent::Undefined;
 }
 
+// Vocabularies of the Kill and Pacify events' classification strings, interned while decoding so validation compares
+// integers. None is the empty string and Other is any value not listed, which the event JSON still has in full.
+enum class eKillMethodBroad : uint8_t {
+	None,
+	Other,
+	Accident,
+	AssaultRifle,
+	CloseCombatPistolElimination,
+	Explosive,
+	FiberWire,
+	MeleeLethal,
+	Pistol,
+	Poison,
+	Shotgun,
+	SMG,
+	SniperRifle,
+	Throw,
+	Unarmed,
+};
+
+enum class eKillMethodStrict : uint8_t {
+	None,
+	Other,
+	AccidentBurn,
+	AccidentDrown,
+	AccidentElectric,
+	AccidentExplosion,
+	AccidentPush,
+	AccidentSuspendedObject,
+	ConsumedPoison,
+	InjectedPoison,
+};
+
+enum class eKillClass : uint8_t {
+	None,
+	Other,
+	Ballistic,
+	Explosion,
+	Melee,
+	Poison,
+	Unknown,
+};
+
+enum class eKillItemCategory : uint8_t {
+	None,
+	Other,
+	SMG,
+	Poison,
+};
+
+enum class eDamageEvent : uint8_t {
+	None,
+	Other,
+	Burn,
+	ContextKill,
+	InCloset,
+};
+
+inline constexpr auto killMethodBroadTable = makeKeywordTable<eKillMethodBroad>({
+	{"accident", eKillMethodBroad::Accident},
+	{"assaultrifle", eKillMethodBroad::AssaultRifle},
+	{"close_combat_pistol_elimination", eKillMethodBroad::CloseCombatPistolElimination},
+	{"explosive", eKillMethodBroad::Explosive},
+	{"fiberwire", eKillMethodBroad::FiberWire},
+	{"melee_lethal", eKillMethodBroad::MeleeLethal},
+	{"pistol", eKillMethodBroad::Pistol},
+	{"poison", eKillMethodBroad::Poison},
+	{"shotgun", eKillMethodBroad::Shotgun},
+	{"smg", eKillMethodBroad::SMG},
+	{"sniperrifle", eKillMethodBroad::SniperRifle},
+	{"throw", eKillMethodBroad::Throw},
+	{"unarmed", eKillMethodBroad::Unarmed},
+});
+
+inline constexpr auto killMethodStrictTable = makeKeywordTable<eKillMethodStrict>({
+	{"accident_burn", eKillMethodStrict::AccidentBurn},
+	{"accident_drown", eKillMethodStrict::AccidentDrown},
+	{"accident_electric", eKillMethodStrict::AccidentElectric},
+	{"accident_explosion", eKillMethodStrict::AccidentExplosion},
+	{"accident_push", eKillMethodStrict::AccidentPush},
+	{"accident_suspended_object", eKillMethodStrict::AccidentSuspendedObject},
+	{"consumed_poison", eKillMethodStrict::ConsumedPoison},
+	{"injected_poison", eKillMethodStrict::InjectedPoison},
+});
+
+inline constexpr auto killClassTable = makeKeywordTable<eKillClass>({
+	{"ballistic", eKillClass::Ballistic},
+	{"explosion", eKillClass::Explosion},
+	{"melee", eKillClass::Melee},
+	{"poison", eKillClass::Poison},
+	{"unknown", eKillClass::Unknown},
+});
+
+inline constexpr auto killItemCategoryTable = makeKeywordTable<eKillItemCategory>({
+	{"smg", eKillItemCategory::SMG},
+	{"poison", eKillItemCategory::Poison},
+});
+
+inline constexpr auto damageEventTable = makeKeywordTable<eDamageEvent>({
+	{"Burn", eDamageEvent::Burn},
+	{"ContextKill", eDamageEvent::ContextKill},
+	{"InCloset", eDamageEvent::InCloset},
+});
+
+template<typename TEnum, size_t N>
+constexpr auto internEventString(const KeywordTable<TEnum, N>& table, std::string_view str) -> TEnum {
+	if (str.empty()) return TEnum::None;
+	auto value = table.findExact(str);
+	return value ? *value : TEnum::Other;
+}
+
+// The string a value was interned from, or "(other)" for values outside the vocabulary.
+template<typename TEnum, size_t N>
+constexpr auto getEventStringName(const KeywordTable<TEnum, N>& table, TEnum value) -> std::string_view {
+	if (value == TEnum::None) return "";
+	for (auto& [name, entry] : table) {
+		if (entry == value) return name;
+	}
+	return "(other)";
+}
+
+inline auto getKillMethodBroadFromString(std::string_view str) -> eKillMethodBroad {
+	return internEventString(killMethodBroadTable, str);
+}
+
+inline auto getKillMethodStrictFromString(std::string_view str) -> eKillMethodStrict {
+	return internEventString(killMethodStrictTable, str);
+}
+
+inline auto getKillClassFromString(std::string_view str) -> eKillClass {
+	return internEventString(killClassTable, str);
+}
+
+inline auto getKillItemCategoryFromString(std::string_view str) -> eKillItemCategory {
+	return internEventString(killItemCategoryTable, str);
+}
+
+inline auto getDamageEventFromString(std::string_view str) -> eDamageEvent {
+	return internEventString(damageEventTable, str);
+}
+
 inline auto getMissionTypeFromString(const std::string& str) -> std::optional<MissionType> {
 	static const std::unordered_map<std::string, MissionType> map = {{
 		{"arcade", MissionType::Arcade},
@@ -0,0 +1,286 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "KeywordTable.h"
+
+// Compile-time descriptions of how event values are read from their JSON objects. A struct opts in with a
+// `static constexpr auto fields()` returning a tuple of the descriptors below, and EventFieldTable turns that into a
+// perfect hash of the keys and a set of type-erased operations per field, for EventValueReader to drive.
+
+// Reads a key into a member: booleans, numbers (cast like nlohmann::json's get would), strings, structs with their own
+// fields(), and vectors of strings or of such structs. std::pmr strings and vectors are allocated from the reader's
+// memory resource. With `convert`, the value is read as the converter's parameter type and its result is assigned, or
+// left alone if it's an empty optional; for a vector, each string element is converted and appended.
+template<typename TClass, typename TMember, typename TConvert = std::nullptr_t>
+struct EventField {
+	std::string_view name;
+	TMember TClass::* member;
+	TConvert convert = nullptr;
+};
+
+// Hands a key's value to a function, for values that don't map onto one member.
+template<typename TClass, typename TArg>
+struct EventFieldSetter {
+	std::string_view name;
+	void (*set)(TClass&, TArg);
+};
+
+// Sets a member when the key is present, whatever its value.
+template<typename TClass>
+struct EventFieldPresence {
+	std::string_view name;
+	bool TClass::* member;
+};
+
+template<typename TClass, typename TMember>
+constexpr auto eventField(std::string_view name, TMember TClass::* member) {
+	return EventField<TClass, TMember>{name, member};
+}
+
+template<typename TClass, typename TMember, typename TResult, typename TArg>
+constexpr auto eventField(std::string_view name, TMember TClass::* member, TResult (*convert)(TArg)) {
+	return EventField<TClass, TMember, TResult (*)(TArg)>{name, member, convert};
+}
+
+template<typename TClass, typename TArg>
+constexpr auto eventFieldSetter(std::string_view name, void (*set)(TClass&, TArg)) {
+	return EventFieldSetter<TClass, TArg>{name, set};
+}
+
+template<typename TClass>
+constexpr auto eventFieldPresence(std::string_view name, bool TClass::* member) {
+	return EventFieldPresence<TClass>{name, member};
+}
+
+template<typename T>
+concept EventFieldStruct = requires { T::fields(); };
+
+struct EventFieldOps;
+struct EventFieldTableView;
+
+// An object being read into and the table of its fields.
+struct EventFieldTarget {
+	void* object = nullptr;
+	const EventFieldTableView* table = nullptr;
+};
+
+// What a field does with each kind of value, null for the kinds it doesn't take.
+struct EventFieldOps {
+	void (*present)(void*) = nullptr;
+	void (*boolean)(void*, bool) = nullptr;
+	void (*integer)(void*, int64_t) = nullptr;
+	void (*unsignedInteger)(void*, uint64_t) = nullptr;
+	void (*floating)(void*, double) = nullptr;
+	void (*string)(void*, std::string&, std::pmr::memory_resource*) = nullptr;
+	// Object values are read into the returned target.
+	EventFieldTarget (*object)(void*) = nullptr;
+	// Arrays call startArray, then stringElement for each string or element for each object to read into.
+	void (*startArray)(void*, std::pmr::memory_resource*) = nullptr;
+	void (*stringElement)(void*, std::string&) = nullptr;
+	EventFieldTarget (*element)(void*) = nullptr;
+};
+
+struct EventFieldTableView {
+	KeywordTableView<uint16_t> keys;
+	std::span<const EventFieldOps> fields;
+
+	auto find(std::string_view key) const -> const EventFieldOps* {
+		auto index = this->keys.findExact(key);
+		return index ? &this->fields[*index] : nullptr;
+	}
+};
+
+template<EventFieldStruct T>
+struct EventFieldTable;
+
+namespace EventFieldDetail {
+	template<typename T>
+	struct IsVector : std::false_type {};
+	template<typename T>
+	struct IsVector<std::vector<T>> : std::true_type {};
+
+	template<typename T>
+	struct IsPmrVector : std::false_type {};
+	template<typename T>
+	struct IsPmrVector<std::pmr::vector<T>> : std::true_type {};
+
+	template<typename T>
+	struct IsOptional : std::false_type {};
+	template<typename T>
+	struct IsOptional<std::optional<T>> : std::true_type {};
+
+	// Type of the value a converter or setter takes, its last parameter.
+	template<typename T>
+	struct ValueArg;
+	template<typename TResult, typename... TArgs>
+	struct ValueArg<TResult (*)(TArgs...)> {
+		using Type = std::remove_cvref_t<std::tuple_element_t<sizeof...(TArgs) - 1, std::tuple<TArgs...>>>;
+	};
+
+	template<typename T>
+	struct IsEventField : std::false_type {};
+	template<typename TClass, typename TMember, typename TConvert>
+	struct IsEventField<EventField<TClass, TMember, TConvert>> : std::true_type {};
+
+	template<typename T>
+	struct IsEventFieldSetter : std::false_type {};
+	template<typename TClass, typename TArg>
+	struct IsEventFieldSetter<EventFieldSetter<TClass, TArg>> : std::true_type {};
+
+	template<typename T>
+	struct IsEventFieldPresence : std::false_type {};
+	template<typename TClass>
+	struct IsEventFieldPresence<EventFieldPresence<TClass>> : std::true_type {};
+
+	// Field I of T, evaluated again wherever it's needed so the operations stay captureless.
+	template<typename T, size_t I>
+	constexpr auto field() {
+		return std::get<I>(T::fields());
+	}
+
+	template<typename T>
+	auto target(T& object) -> EventFieldTarget {
+		return {&object, &EventFieldTable<T>::view};
+	}
+
+	template<typename T, size_t I>
+	auto member(void* object) -> auto& {
+		return static_cast<T*>(object)->*field<T, I>().member;
+	}
+
+	// The allocator of a pmr container never changes on assignment, so an empty one is rebuilt on the resource instead.
+	template<typename T>
+	auto rebind(T& container, std::pmr::memory_resource* resource) -> T& {
+		if (container.get_allocator().resource() != resource) {
+			std::destroy_at(&container);
+			std::construct_at(&container, resource);
+		}
+		return container;
+	}
+
+	template<typename T, size_t I>
+	struct AssignMember {
+		template<typename TValue>
+		static auto set(void* object, TValue&& value) -> void {
+			member<T, I>(object) = std::forward<TValue>(value);
+		}
+	};
+
+	template<typename T, size_t I>
+	struct AssignConverted {
+		template<typename TValue>
+		static auto set(void* object, TValue&& value) -> void {
+			auto result = field<T, I>().convert(std::forward<TValue>(value));
+			if constexpr (IsOptional<decltype(result)>::value) {
+				if (result) member<T, I>(object) = std::move(*result);
+			}
+			else member<T, I>(object) = std::move(result);
+		}
+	};
+
+	template<typename T, size_t I>
+	struct CallSetter {
+		template<typename TValue>
+		static auto set(void* object, TValue&& value) -> void {
+			field<T, I>().set(*static_cast<T*>(object), std::forward<TValue>(value));
+		}
+	};
+
+	// Takes values that can be read as a TValue and passes them to TSink.
+	template<typename TValue, typename TSink>
+	consteval auto setValueOps(EventFieldOps& ops) -> void {
+		if constexpr (std::is_same_v<TValue, bool>) {
+			ops.boolean = [](void* object, bool b) { TSink::set(object, b); };
+		}
+		else if constexpr (std::is_arithmetic_v<TValue>) {
+			ops.integer = [](void* object, int64_t n) { TSink::set(object, static_cast<TValue>(n)); };
+			ops.unsignedInteger = [](void* object, uint64_t n) { TSink::set(object, static_cast<TValue>(n)); };
+			ops.floating = [](void* object, double n) { TSink::set(object, static_cast<TValue>(n)); };
+		}
+		else {
+			static_assert(std::is_same_v<TValue, std::string> || std::is_same_v<TValue, std::string_view>, "Event fields of other types need a converter or setter");
+			ops.string = [](void* object, std::string& str, std::pmr::memory_resource*) { TSink::set(object, std::move(str)); };
+		}
+	}
+
+	// Clears a vector member at the start of its array.
+	template<typename T, size_t I>
+	consteval auto setStartArrayOps(EventFieldOps& ops) -> void {
+		if constexpr (IsPmrVector<std::remove_cvref_t<decltype(member<T, I>(nullptr))>>::value)
+			ops.startArray = [](void* object, std::pmr::memory_resource* resource) { rebind(member<T, I>(object), resource).clear(); };
+		else
+			ops.startArray = [](void* object, std::pmr::memory_resource*) { member<T, I>(object).clear(); };
+	}
+
+	template<typename T, size_t I>
+	consteval auto makeOps() -> EventFieldOps {
+		using Field = decltype(field<T, I>());
+		EventFieldOps ops;
+
+		if constexpr (IsEventFieldPresence<Field>::value) {
+			ops.present = [](void* object) { member<T, I>(object) = true; };
+		}
+		else if constexpr (IsEventFieldSetter<Field>::value) {
+			setValueOps<typename ValueArg<decltype(Field::set)>::Type, CallSetter<T, I>>(ops);
+		}
+		else {
+			static_assert(IsEventField<Field>::value, "Not an event field descriptor");
+			using Member = std::remove_cvref_t<decltype(member<T, I>(nullptr))>;
+
+			if constexpr (!std::is_same_v<decltype(Field::convert), std::nullptr_t> && (IsVector<Member>::value || IsPmrVector<Member>::value)) {
+				setStartArrayOps<T, I>(ops);
+				ops.stringElement = [](void* object, std::string& str) { member<T, I>(object).push_back(field<T, I>().convert(str)); };
+			}
+			else if constexpr (!std::is_same_v<decltype(Field::convert), std::nullptr_t>) {
+				setValueOps<typename ValueArg<decltype(Field::convert)>::Type, AssignConverted<T, I>>(ops);
+			}
+			else if constexpr (EventFieldStruct<Member>) {
+				ops.object = [](void* object) { return target(member<T, I>(object)); };
+			}
+			else if constexpr (std::is_same_v<Member, std::pmr::string>) {
+				ops.string = [](void* object, std::string& str, std::pmr::memory_resource* resource) {
+					rebind(member<T, I>(object), resource).assign(str);
+				};
+			}
+			else if constexpr (IsVector<Member>::value || IsPmrVector<Member>::value) {
+				using Element = typename Member::value_type;
+				setStartArrayOps<T, I>(ops);
+				if constexpr (EventFieldStruct<Element>)
+					ops.element = [](void* object) { return target(member<T, I>(object).emplace_back()); };
+				else {
+					static_assert(std::is_same_v<Element, std::string> || std::is_same_v<Element, std::pmr::string>, "Event field arrays hold strings or structs with fields");
+					ops.stringElement = [](void* object, std::string& str) { member<T, I>(object).emplace_back(std::move(str)); };
+				}
+			}
+			else setValueOps<Member, AssignMember<T, I>>(ops);
+		}
+		return ops;
+	}
+}
+
+template<EventFieldStruct T>
+struct EventFieldTable {
+	static constexpr size_t numFields = std::tuple_size_v<decltype(T::fields())>;
+
+	static constexpr auto keys = KeywordTable<uint16_t, numFields>{[]<size_t... I>(std::index_sequence<I...>) {
+		return std::array<KeywordTableView<uint16_t>::Entry, numFields>{{
+			{EventFieldDetail::field<T, I>().name, static_cast<uint16_t>(I)}...
+		}};
+	}(std::make_index_sequence<numFields>{})};
+
+	static constexpr auto ops = []<size_t... I>(std::index_sequence<I...>) {
+		return std::array<EventFieldOps, numFields>{EventFieldDetail::makeOps<T, I>()...};
+	}(std::make_index_sequence<numFields>{});
+
+	static constexpr auto view = EventFieldTableView{keys.view(), ops};
+};
@@ -0,0 +1,124 @@
+#include "EventLog.h"
+#include <bit>
+
+namespace {
+	template<typename T>
+	auto appendInt(std::vector<uint8_t>& out, T value) -> void {
+		for (size_t i = 0; i < sizeof(T); ++i)
+			out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8)));
+	}
+
+	template<typename T>
+	auto readInt(std::istream& in, T& value) -> bool {
+		uint8_t bytes[sizeof(T)];
+		if (!in.read(reinterpret_cast<char*>(bytes), sizeof(T))) return false;
+		uint64_t result = 0;
+		for (size_t i = 0; i < sizeof(T); ++i)
+			result |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+		value = static_cast<T>(result);
+		return true;
+	}
+}
+
+auto EventLogWriter::open(const std::filesystem::path& path) -> bool {
+	this->close();
+
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+	this->file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!this->file.is_open()) return false;
+
+	this->buffer.assign(eventLogMagic.begin(), eventLogMagic.end());
+	appendInt(this->buffer, eventLogVersion);
+	this->file.write(reinterpret_cast<const char*>(this->buffer.data()), this->buffer.size());
+	return this->file.good();
+}
+
+auto EventLogWriter::close() -> void {
+	if (this->file.is_open()) this->file.close();
+}
+
+auto EventLogWriter::write(const nlohmann::json& event) -> void {
+	if (!this->file.is_open()) return;
+
+	std::string_view name;
+	if (auto it = event.find("Name"); it != event.end() && it->is_string())
+		name = it->get_ref<const std::string&>();
+
+	this->payload.clear();
+	nlohmann::json::to_msgpack(event, this->payload);
+	this->write(name, event.value("Timestamp", 0.0), this->payload);
+}
+
+auto EventLogWriter::write(std::string_view name, double timestamp, std::span<const uint8_t> payload) -> void {
+	if (!this->file.is_open()) return;
+
+	name = name.substr(0, 0xFFFF);
+	this->buffer.clear();
+	appendInt(this->buffer, static_cast<uint16_t>(name.size()));
+	this->buffer.insert(this->buffer.end(), name.begin(), name.end());
+	appendInt(this->buffer, std::bit_cast<uint64_t>(timestamp));
+	appendInt(this->buffer, static_cast<uint32_t>(payload.size()));
+
+	this->file.write(reinterpret_cast<const char*>(this->buffer.data()), this->buffer.size());
+	this->file.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+	// Flushed per event so a crash doesn't take the end of the session with it, events are far apart.
+	this->file.flush();
+}
+
+auto EventLogReader::open(const std::filesystem::path& path) -> bool {
+	this->errorMessage.clear();
+	if (this->file.is_open()) this->file.close();
+	this->file.clear();
+	this->file.open(path, std::ios::in | std::ios::binary);
+	if (!this->file.is_open()) {
+		this->errorMessage = "could not open file";
+		return false;
+	}
+
+	char magic[eventLogMagic.size()];
+	uint32_t version = 0;
+	if (!this->file.read(magic, sizeof(magic)) || std::string_view(magic, sizeof(magic)) != eventLogMagic) {
+		this->errorMessage = "not an event log";
+		return false;
+	}
+	if (!readInt(this->file, version) || version != eventLogVersion) {
+		this->errorMessage = "unsupported event log version";
+		return false;
+	}
+	return true;
+}
+
+auto EventLogReader::read(EventLogRecord& record) -> bool {
+	if (!this->file.is_open() || !this->errorMessage.empty()) return false;
+
+	uint16_t nameLength = 0;
+	if (!readInt(this->file, nameLength)) {
+		// Running out exactly between records is the normal end of a log.
+		if (this->file.gcount() != 0) this->errorMessage = "truncated record";
+		return false;
+	}
+
+	uint64_t timestamp = 0;
+	uint32_t payloadLength = 0;
+	record.name.resize(nameLength);
+	if (!this->file.read(record.name.data(), nameLength) || !readInt(this->file, timestamp) || !readInt(this->file, payloadLength)) {
+		this->errorMessage = "truncated record";
+		return false;
+	}
+
+	this->buffer.resize(payloadLength);
+	if (!this->file.read(reinterpret_cast<char*>(this->buffer.data()), payloadLength)) {
+		this->errorMessage = "truncated record";
+		return false;
+	}
+
+	record.timestamp = std::bit_cast<double>(timestamp);
+	record.event = nlohmann::json::from_msgpack(this->buffer, true, false);
+	if (record.event.is_discarded()) {
+		this->errorMessage = "invalid event payload";
+		return false;
+	}
+	return true;
+}
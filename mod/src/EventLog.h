@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "json.hpp"
+
+// Binary log of game events, recorded in-game so sessions can be replayed offline.
+// The file starts with `eventLogMagic` and a u32 version, followed by one record per event:
+//   u16 name length, name, f64 timestamp, u32 payload length, payload (the whole event as MessagePack)
+// Integers and floats are little endian.
+constexpr std::string_view eventLogMagic = "CRPEVLOG";
+constexpr uint32_t eventLogVersion = 1;
+
+struct EventLogRecord {
+	std::string name;
+	double timestamp = 0;
+	nlohmann::json event;
+};
+
+class EventLogWriter
+{
+public:
+	auto open(const std::filesystem::path& path) -> bool;
+	auto close() -> void;
+	auto isOpen() const -> bool { return this->file.is_open(); }
+	auto write(const nlohmann::json& event) -> void;
+	// Writes a record for an event already encoded as MessagePack.
+	auto write(std::string_view name, double timestamp, std::span<const uint8_t> payload) -> void;
+
+private:
+	std::ofstream file;
+	std::vector<uint8_t> buffer;
+	std::vector<uint8_t> payload;
+};
+
+class EventLogReader
+{
+public:
+	auto open(const std::filesystem::path& path) -> bool;
+	// Reads the next record, returning false at the end of the log or if the rest of it is unreadable (see error()).
+	auto read(EventLogRecord& record) -> bool;
+	auto error() const -> const std::string& { return this->errorMessage; }
+
+private:
+	std::ifstream file;
+	std::vector<uint8_t> buffer;
+	std::string errorMessage;
+};
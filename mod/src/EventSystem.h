@@ -1,29 +1,85 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
-#include <unordered_map>
+#include <vector>
 #include "json.hpp"
+#include "Enums.h"
+#include "EventValueReader.h"
+#include "MessagePack.h"
 
-enum class Events;
 template<Events>
 struct Event;
 
+// What an event's value is read into from its MessagePack before it's made into the EventValue listeners get. Values
+// that describe their own fields() are read in place, other kinds specialise this, with void for values not read.
+template<typename TValue>
+struct EventValueWire {
+	using Type = TValue;
+};
+
+// The fields every event sent to the server has besides its value. Strings are allocated from the decoding resource.
+struct ServerEventHeader {
+	std::pmr::string Name;
+	std::pmr::string ContractId;
+	std::pmr::string ContractSessionId;
+	double Timestamp = 0;
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("Name", &ServerEventHeader::Name),
+			eventField("ContractId", &ServerEventHeader::ContractId),
+			eventField("ContractSessionId", &ServerEventHeader::ContractSessionId),
+			eventField("Timestamp", &ServerEventHeader::Timestamp),
+		};
+	}
+};
+
+template<typename TWire>
+struct ServerEventEnvelope : ServerEventHeader {
+	TWire Value{};
+
+	static constexpr auto fields() {
+		return std::tuple_cat(ServerEventHeader::fields(), std::tuple{
+			eventField("Value", &ServerEventEnvelope::Value),
+		});
+	}
+};
+
+template<>
+struct ServerEventEnvelope<void> : ServerEventHeader { };
+
+// Only valid during dispatch, the payload and envelope strings belong to the event being handled, and the value's
+// strings and arrays to the memory resource it was decoded with.
 template<Events T>
 class ServerEvent
 {
 public:
-	nlohmann::json json;
+	// The whole event as MessagePack.
+	std::span<const uint8_t> Payload;
 	typename Event<T>::EventValue Value;
-	std::string ContractSessionId;
-	std::string ContractId;
-	std::string Name;
+	std::string_view ContractSessionId;
+	std::string_view ContractId;
+	std::string_view Name;
 	double Timestamp = 0;
 
 public:
-	ServerEvent(typename Event<T>::EventValue&& value) : Value(std::forward<typename Event<T>::EventValue>(value))
+	ServerEvent(std::span<const uint8_t> payload, typename Event<T>::EventValue&& value) :
+		Payload(payload), Value(std::forward<typename Event<T>::EventValue>(value))
 	{ }
+
+	// Decodes the whole event, for logging. Allocates, so it's not for the paths every event takes.
+	auto toJson() const -> nlohmann::json {
+		return nlohmann::json::from_msgpack(this->Payload, true, false);
+	}
 };
 
 extern std::unordered_set<std::string> eventNameBlacklist;
@@ -31,15 +87,13 @@ extern std::unordered_set<std::string> eventNameBlacklist;
 class EventListenersBase
 {
 protected:
-	auto virtual call(const nlohmann::json& ev) const -> bool = 0;
+	auto virtual call(std::span<const uint8_t> payload, std::pmr::memory_resource* resource) const -> bool = 0;
 
 public:
-	auto operator()(const nlohmann::json& ev) const -> bool {
-		return this->call(ev);
-	}
+	virtual ~EventListenersBase() = default;
 
-	auto handle(const nlohmann::json& ev) const -> bool {
-		return this->call(ev);
+	auto handle(std::span<const uint8_t> payload, std::pmr::memory_resource* resource) const -> bool {
+		return this->call(payload, resource);
 	}
 };
 
@@ -58,16 +112,24 @@ public:
 	}
 
 protected:
-	auto call(const nlohmann::json& ev) const -> bool {
-		auto it = ev.find("Value");
-		if (it == ev.end()) return false;
-
-		ServerEvent<TEvent> serverEvent{typename Event<TEvent>::EventValue(*it)};
-		serverEvent.json  = ev;
-		serverEvent.Name = ev.value("Name", "");
-		serverEvent.ContractId = ev.value("ContractId", "");
-		serverEvent.ContractSessionId = ev.value("ContractSessionId", "");
-		serverEvent.Timestamp = ev.value("Timestamp", 0.0);
+	auto call(std::span<const uint8_t> payload, std::pmr::memory_resource* resource) const -> bool {
+		using Value = typename Event<TEvent>::EventValue;
+		using Wire = typename EventValueWire<Value>::Type;
+
+		// Read in one pass straight from the payload, with no DOM in between.
+		ServerEventEnvelope<Wire> envelope;
+		EventValueReader reader(envelope, resource);
+		if (!visitMessagePack(payload, reader))
+			return false;
+
+		auto serverEvent = [&] {
+			if constexpr (std::is_void_v<Wire>) return ServerEvent<TEvent>{payload, Value()};
+			else return ServerEvent<TEvent>{payload, Value(std::move(envelope.Value))};
+		}();
+		serverEvent.Name = envelope.Name;
+		serverEvent.ContractId = envelope.ContractId;
+		serverEvent.ContractSessionId = envelope.ContractSessionId;
+		serverEvent.Timestamp = envelope.Timestamp;
 
 		for (auto& handler : this->handlers)
 			handler(serverEvent);
@@ -79,54 +141,36 @@ private:
 	std::vector<std::function<HandlerFunc>> handlers;
 };
 
+// Listeners are kept in a fixed table indexed by event ID, see getEventByName for mapping names to IDs.
 class EventSystem {
 public:
 	template<Events TEvent>
-	auto listen(std::function<void(const ServerEvent<TEvent>&)> handler) {
-		auto eventNameIt = this->eventNames.find(TEvent);
-		if (eventNameIt == this->eventNames.end())
-			eventNameIt = this->eventNames.emplace(TEvent, Event<TEvent>::Name).first;
-		
-		auto it = this->listeners.find(eventNameIt->second);
-		if (it == this->listeners.end())
-			it = this->listeners.emplace(eventNameIt->second, std::make_unique<EventListeners<TEvent>>()).first;
-		static_cast<EventListeners<TEvent>*>(it->second.get())->add(handler);
+	auto listen(std::function<void(const ServerEvent<TEvent>&)> handler) -> void {
+		auto& listeners = this->listeners[static_cast<size_t>(TEvent)];
+		if (!listeners) listeners = std::make_unique<EventListeners<TEvent>>();
+		static_cast<EventListeners<TEvent>*>(listeners.get())->add(std::move(handler));
 	}
 
-	auto handle(const std::string& str, const nlohmann::json& json) -> bool {
-		auto listeners = this->findListeners(str);
-		if (listeners) return listeners->handle(json);
-		return false;
+	auto hasListeners(Events ev) const -> bool {
+		return this->listeners[static_cast<size_t>(ev)] != nullptr;
 	}
 
-	auto handle(Events ev, const nlohmann::json& json) {
-		auto listeners = this->findListeners(ev);
-		if (listeners) return listeners->handle(json);
+	// Decodes the event from its MessagePack with `resource`, which can be reset once this returns.
+	auto handle(Events ev, std::span<const uint8_t> payload, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const -> bool {
+		auto& listeners = this->listeners[static_cast<size_t>(ev)];
+		if (listeners) return listeners->handle(payload, resource);
 		return false;
 	}
 
-	auto getEventName(Events ev) -> const std::string* {
-		auto it = this->eventNames.find(ev);
-		if (it != this->eventNames.end())
-			return &it->second;
-		return nullptr;
-	}
-
-private:
-	auto findListeners(Events ev) -> EventListenersBase* {
-		auto name = this->getEventName(ev);
-		if (name) return this->findListeners(*name);
-		return nullptr;
-	}
-
-	auto findListeners(const std::string& name) -> EventListenersBase* {
-		auto it = this->listeners.find(name);
-		if (it != this->listeners.end())
-			return it->second.get();
-		return nullptr;
+	// Handles an event that's already been parsed, by encoding it as the game thread would have.
+	auto handle(Events ev, const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const -> bool {
+		if (!this->hasListeners(ev)) return false;
+		thread_local std::vector<uint8_t> payload;
+		payload.clear();
+		nlohmann::json::to_msgpack(json, payload);
+		return this->handle(ev, std::span<const uint8_t>(payload), resource);
 	}
 
 private:
-	std::unordered_map<Events, std::string> eventNames;
-	std::unordered_map<std::string, std::unique_ptr<EventListenersBase>> listeners;
+	std::array<std::unique_ptr<EventListenersBase>, numEvents> listeners;
 };
@@ -0,0 +1,161 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Events of one kind in timestamp order, answering what happened at or around a time in O(log n). T needs a
+// 'timestamp' member. Entries older than a given time can be compacted away, keeping the last of them as what was still
+// true at that time. Like a vector, adding or compacting invalidates pointers to entries.
+template<typename T>
+class EventTimeline
+{
+public:
+	// Compacted entries are only erased once they make up this many and half the timeline, so compaction is amortised.
+	static constexpr size_t minErase = 32;
+
+	// Events arrive in timestamp order, so this is an append unless one comes in late.
+	auto add(T entry) -> const T& {
+		auto it = std::upper_bound(this->entries.begin() + this->first, this->entries.end(), static_cast<double>(entry.timestamp), [](double timestamp, const T& e) {
+			return timestamp < e.timestamp;
+		});
+		return *this->entries.insert(it, std::move(entry));
+	}
+
+	// The latest entry from strictly before the timestamp.
+	auto lastBefore(double timestamp) const -> const T* {
+		auto it = this->lowerBound(timestamp);
+		return it == this->begin() ? nullptr : &*std::prev(it);
+	}
+
+	// The latest entry less than the margin away from the timestamp.
+	auto latestWithin(double timestamp, double margin) const -> const T* {
+		auto from = std::upper_bound(this->begin(), this->end(), timestamp - margin, [](double timestamp, const T& e) {
+			return timestamp < e.timestamp;
+		});
+		auto to = this->lowerBound(timestamp + margin);
+		return from == to ? nullptr : &*std::prev(to);
+	}
+
+	auto latest() const -> const T* {
+		return this->empty() ? nullptr : &this->entries.back();
+	}
+
+	// Drops the entries from before the timestamp, except the last of them.
+	auto compactBefore(double timestamp) -> void {
+		auto it = this->lowerBound(timestamp);
+		if (it == this->begin()) return;
+
+		this->first = static_cast<size_t>(std::prev(it) - this->entries.begin());
+		if (this->first >= minErase && this->first * 2 >= this->entries.size()) {
+			this->entries.erase(this->entries.begin(), this->entries.begin() + this->first);
+			this->first = 0;
+		}
+	}
+
+	// Drops the entries from after the timestamp, e.g. when a save from then is loaded.
+	auto truncateAfter(double timestamp) -> void {
+		auto it = std::upper_bound(this->entries.begin(), this->entries.end(), timestamp, [](double timestamp, const T& e) {
+			return timestamp < e.timestamp;
+		});
+		this->entries.erase(it, this->entries.end());
+		// Bring back the last compacted entry if the ones after it have gone.
+		this->first = std::min(this->first, this->entries.empty() ? 0 : this->entries.size() - 1);
+	}
+
+	auto clear() -> void {
+		this->entries.clear();
+		this->first = 0;
+	}
+
+	auto begin() const { return this->entries.begin() + this->first; }
+	auto end() const { return this->entries.end(); }
+	auto size() const -> size_t { return this->entries.size() - this->first; }
+	auto empty() const -> bool { return this->size() == 0; }
+
+private:
+	auto lowerBound(double timestamp) const {
+		return std::lower_bound(this->begin(), this->end(), timestamp, [](const T& e, double timestamp) {
+			return e.timestamp < timestamp;
+		});
+	}
+
+	std::vector<T> entries;
+	// Entries before this have been compacted and are waiting to be erased.
+	size_t first = 0;
+};
+
+// An EventTimeline that also keeps the entries of each name. Compacting keeps the last entry of each name from before
+// the time, so the latest of a name is still found after a load rewinds past later ones.
+template<typename T, std::string T::*Name>
+class NamedEventTimeline : private EventTimeline<T>
+{
+public:
+	using EventTimeline<T>::lastBefore;
+	using EventTimeline<T>::latestWithin;
+	using EventTimeline<T>::latest;
+	using EventTimeline<T>::begin;
+	using EventTimeline<T>::end;
+	using EventTimeline<T>::size;
+	using EventTimeline<T>::empty;
+
+	auto add(T entry) -> const T& {
+		auto& named = this->byName[entry.*Name];
+		auto it = std::upper_bound(named.begin(), named.end(), static_cast<double>(entry.timestamp), [](double timestamp, const T& e) {
+			return timestamp < e.timestamp;
+		});
+		named.insert(it, entry);
+		return EventTimeline<T>::add(std::move(entry));
+	}
+
+	auto latestNamed(std::string_view name) const -> const T* {
+		auto it = this->byName.find(name);
+		return it == this->byName.end() ? nullptr : &it->second.back();
+	}
+
+	// Entries kept for the name.
+	auto countNamed(std::string_view name) const -> size_t {
+		auto it = this->byName.find(name);
+		return it == this->byName.end() ? 0 : it->second.size();
+	}
+
+	// Drops the entries from before the timestamp, except the last of them and the last of each name.
+	auto compactBefore(double timestamp) -> void {
+		EventTimeline<T>::compactBefore(timestamp);
+
+		for (auto& [name, named] : this->byName) {
+			auto it = std::lower_bound(named.begin(), named.end(), timestamp, [](const T& e, double timestamp) {
+				return e.timestamp < timestamp;
+			});
+			if (it != named.begin()) named.erase(named.begin(), std::prev(it));
+		}
+	}
+
+	// Names whose latest entry is dropped fall back to their latest entry left.
+	auto truncateAfter(double timestamp) -> void {
+		EventTimeline<T>::truncateAfter(timestamp);
+
+		for (auto it = this->byName.begin(); it != this->byName.end();) {
+			auto& named = it->second;
+			auto from = std::upper_bound(named.begin(), named.end(), timestamp, [](double timestamp, const T& e) {
+				return timestamp < e.timestamp;
+			});
+			named.erase(from, named.end());
+			if (named.empty()) it = this->byName.erase(it);
+			else ++it;
+		}
+	}
+
+	auto clear() -> void {
+		EventTimeline<T>::clear();
+		this->byName.clear();
+	}
+
+private:
+	// Never empty, each name's entries in timestamp order.
+	std::map<std::string, std::vector<T>, std::less<>> byName;
+};
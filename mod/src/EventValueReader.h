@@ -0,0 +1,199 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include "EventFields.h"
+#include "json.hpp"
+
+// Reads an object straight into a struct described by fields() in one forward pass over a SAX-style stream, from
+// nlohmann::json::sax_parse (JSON text or MessagePack), visitMessagePack, visitDynamicObject, or visitJson for a DOM.
+// Keys are found through each struct's perfect hash; unknown keys and values of a type the field doesn't take are skipped.
+// std::pmr members are allocated from `resource`, which has to outlive the value.
+class EventFieldReader
+{
+public:
+	EventFieldReader(EventFieldTarget root, std::pmr::memory_resource* resource) : root(root), resource(resource) { }
+
+	auto null() -> bool { return true; }
+	auto binary(nlohmann::json::binary_t&) -> bool { return true; }
+
+	auto boolean(bool b) -> bool {
+		if (auto field = this->valueField(); field && field->boolean) field->boolean(this->object(), b);
+		return true;
+	}
+
+	auto number_integer(int64_t n) -> bool {
+		if (auto field = this->valueField(); field && field->integer) field->integer(this->object(), n);
+		return true;
+	}
+
+	auto number_unsigned(uint64_t n) -> bool {
+		if (auto field = this->valueField(); field && field->unsignedInteger) field->unsignedInteger(this->object(), n);
+		return true;
+	}
+
+	auto number_float(double n, const std::string&) -> bool {
+		if (auto field = this->valueField(); field && field->floating) field->floating(this->object(), n);
+		return true;
+	}
+
+	auto string(std::string& str) -> bool {
+		if (auto field = this->valueField(); field && field->string) field->string(this->object(), str, this->resource);
+		else if (auto array = this->arrayField(); array && array->stringElement) array->stringElement(this->object(), str);
+		return true;
+	}
+
+	auto key(std::string_view str) -> bool {
+		if (this->skipDepth || !this->depth) return true;
+		auto& frame = this->frames[this->depth - 1];
+		frame.field = frame.target.table->find(str);
+		if (frame.field && frame.field->present) frame.field->present(frame.target.object);
+		return true;
+	}
+
+	auto start_object(size_t) -> bool {
+		if (!this->skipDepth && this->depth < maxDepth) {
+			if (!this->depth && !this->started) {
+				this->started = true;
+				return this->push({this->root});
+			}
+			if (auto field = this->valueField(); field && field->object)
+				return this->push({field->object(this->object())});
+			if (auto array = this->arrayField(); array && array->element)
+				return this->push({array->element(this->object())});
+		}
+		++this->skipDepth;
+		return true;
+	}
+
+	auto start_array(size_t) -> bool {
+		if (!this->skipDepth && this->depth < maxDepth) {
+			if (auto field = this->valueField(); field && field->startArray) {
+				field->startArray(this->object(), this->resource);
+				return this->push({this->frames[this->depth - 1].target, nullptr, field});
+			}
+		}
+		++this->skipDepth;
+		return true;
+	}
+
+	auto end_object() -> bool { return this->close(); }
+	auto end_array() -> bool { return this->close(); }
+
+	auto parse_error(size_t, const std::string&, const nlohmann::detail::exception&) -> bool {
+		return false;
+	}
+
+private:
+	struct Frame {
+		EventFieldTarget target;
+		// Field of the current key, for an object.
+		const EventFieldOps* field = nullptr;
+		// Field the elements belong to, for an array.
+		const EventFieldOps* array = nullptr;
+	};
+
+	// Event values nest a few levels at most, anything deeper is skipped.
+	static constexpr size_t maxDepth = 8;
+
+	auto object() const -> void* {
+		return this->frames[this->depth - 1].target.object;
+	}
+
+	auto valueField() const -> const EventFieldOps* {
+		if (this->skipDepth || !this->depth) return nullptr;
+		return this->frames[this->depth - 1].field;
+	}
+
+	auto arrayField() const -> const EventFieldOps* {
+		if (this->skipDepth || !this->depth) return nullptr;
+		return this->frames[this->depth - 1].array;
+	}
+
+	auto push(const Frame& frame) -> bool {
+		this->frames[this->depth++] = frame;
+		return true;
+	}
+
+	auto close() -> bool {
+		if (this->skipDepth) --this->skipDepth;
+		else if (this->depth) --this->depth;
+		return true;
+	}
+
+	EventFieldTarget root;
+	std::pmr::memory_resource* resource;
+	std::array<Frame, maxDepth> frames{};
+	size_t depth = 0;
+	size_t skipDepth = 0;
+	bool started = false;
+};
+
+template<typename T>
+class EventValueReader : public EventFieldReader
+{
+public:
+	explicit EventValueReader(T& value, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+		EventFieldReader(EventFieldDetail::target(value), resource)
+	{ }
+};
+
+// A whole event as sent to the server, for reading the value out of it without a DOM.
+template<EventFieldStruct TValue>
+struct EventEnvelope {
+	TValue Value;
+	double Timestamp = 0;
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("Value", &EventEnvelope::Value),
+			eventField("Timestamp", &EventEnvelope::Timestamp),
+		};
+	}
+};
+
+// Walks a DOM as the SAX events sax_parse would produce for it. Keys are passed as const strings.
+template<typename TVisitor>
+auto visitJson(const nlohmann::json& json, TVisitor& visitor) -> bool {
+	// Strings are handed over mutable, copied into a buffer kept per thread so decoding doesn't allocate for them.
+	thread_local std::string scratch;
+
+	switch (json.type()) {
+	case nlohmann::json::value_t::object:
+		if (!visitor.start_object(json.size())) return false;
+		for (auto it = json.begin(); it != json.end(); ++it) {
+			if (!visitor.key(it.key()) || !visitJson(it.value(), visitor)) return false;
+		}
+		return visitor.end_object();
+	case nlohmann::json::value_t::array:
+		if (!visitor.start_array(json.size())) return false;
+		for (auto& element : json) {
+			if (!visitJson(element, visitor)) return false;
+		}
+		return visitor.end_array();
+	case nlohmann::json::value_t::string:
+		scratch.assign(json.get_ref<const std::string&>());
+		return visitor.string(scratch);
+	case nlohmann::json::value_t::boolean:
+		return visitor.boolean(json.get<bool>());
+	case nlohmann::json::value_t::number_integer:
+		return visitor.number_integer(json.get<int64_t>());
+	case nlohmann::json::value_t::number_unsigned:
+		return visitor.number_unsigned(json.get<uint64_t>());
+	case nlohmann::json::value_t::number_float:
+		return visitor.number_float(json.get<double>(), {});
+	default:
+		return visitor.null();
+	}
+}
+
+// Fills a struct described by fields() from a DOM, leaving anything missing at its default.
+// Unconstrained so EventValue constructors can call it before their fields() is defined.
+template<typename T>
+auto decodeEventFields(const nlohmann::json& json, T& value, std::pmr::memory_resource* resource) -> void {
+	EventValueReader<T> reader(value, resource);
+	visitJson(json, reader);
+}
@@ -1,13 +1,20 @@
 #pragma once
+#include <array>
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <Glacier/Enums.h>
 #include <Glacier/ZMath.h>
 #include "json.hpp"
 #include "Enums.h"
 #include "EventSystem.h"
+#include "EventValueReader.h"
+#include "KeywordTable.h"
 
 struct GameChanger {
 	//std::string Id;
@@ -24,211 +31,305 @@ struct GameChanger {
 };
 
 struct LoadoutItemEventValue {
-	std::string RepositoryId;
-	std::string InstanceId;
-	std::vector<std::string> OnlineTraits;
-	std::optional<std::nullptr_t> Category;
+	std::pmr::string RepositoryId;
+	std::pmr::string InstanceId;
+	std::pmr::vector<std::pmr::string> OnlineTraits;
+	std::optional<std::nullptr_t> Category = nullptr;
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("RepositoryId", &LoadoutItemEventValue::RepositoryId),
+			eventField("InstanceId", &LoadoutItemEventValue::InstanceId),
+			eventField("OnlineTraits", &LoadoutItemEventValue::OnlineTraits),
+		};
+	}
 };
 
 struct DamageHistoryEventValue {
-	bool Explosive;
-	bool Headshot;
-	bool Accident;
-	bool WeaponSilenced;
-	bool Projectile;
-	bool Sniper;
-	bool ThroughWall;
-	std::string InstanceId;
-	std::string RepositoryId;
-	int BodyPartId;
-	int TotalDamage;
-
-	DamageHistoryEventValue(const nlohmann::json& json) :
-		Explosive(json.value("Explosive", false)),
-		Headshot(json.value("Headshot", false)),
-		Accident(json.value("Accident", false)),
-		WeaponSilenced(json.value("WeaponSilenced", false)),
-		Projectile(json.value("Projectile", false)),
-		Sniper(json.value("Sniper", false)),
-		ThroughWall(json.value("ThroughWall", false)),
-		InstanceId(json.value("InstanceId", "")),
-		RepositoryId(json.value("RepositoryId", "")),
-		BodyPartId(json.value("BodyPartId", 0)),
-		TotalDamage(json.value("TotalDamage", 0))
-	{ }
+	bool Explosive = false;
+	bool Headshot = false;
+	bool Accident = false;
+	bool WeaponSilenced = false;
+	bool Projectile = false;
+	bool Sniper = false;
+	bool ThroughWall = false;
+	std::pmr::string InstanceId;
+	std::pmr::string RepositoryId;
+	int BodyPartId = 0;
+	int TotalDamage = 0;
+
+	DamageHistoryEventValue() = default;
+	DamageHistoryEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	auto operator==(const DamageHistoryEventValue&) const -> bool = default;
+
+	static constexpr auto fields() {
+		using T = DamageHistoryEventValue;
+		return std::tuple{
+			eventField("Explosive", &T::Explosive),
+			eventField("Headshot", &T::Headshot),
+			eventField("Accident", &T::Accident),
+			eventField("WeaponSilenced", &T::WeaponSilenced),
+			eventField("Projectile", &T::Projectile),
+			eventField("Sniper", &T::Sniper),
+			eventField("ThroughWall", &T::ThroughWall),
+			eventField("InstanceId", &T::InstanceId),
+			eventField("RepositoryId", &T::RepositoryId),
+			eventField("BodyPartId", &T::BodyPartId),
+			eventField("TotalDamage", &T::TotalDamage),
+		};
+	}
 };
 
 struct PacifyEventValue {
-	std::string RepositoryId;
-	uint32_t ActorId;
-	std::string ActorName;
-	EActorType ActorType;
-	EKillType KillType;
-	EDeathContext KillContext;
-	std::string KillClass;
-	bool Accident;
-	bool WeaponSilenced;
-	bool Explosive;
-	int ExplosionType;
-	bool Projectile;
-	bool Sniper;
-	bool IsHeadshot;
-	bool IsTarget;
-	bool ThroughWall;
-	int BodyPartId;
-	double TotalDamage;
-	bool IsMoving;
-	int RoomId;
-	std::string ActorPosition;
-	std::string HeroPosition;
-	std::vector<std::string> DamageEvents;
-	int PlayerId;
-	std::string OutfitRepositoryId;
-	std::string SetPieceId;
-	std::string SetPieceType;
-	bool OutfitIsHitmanSuit;
-	std::string KillMethodBroad;
-	std::string KillMethodStrict;
-	int EvergreenRarity;
-	std::vector<DamageHistoryEventValue> History;
-
-	PacifyEventValue(const nlohmann::json& json) :
-		RepositoryId(json.value("RepositoryId", "")),
-		ActorId(json.value("ActorId", 0)),
-		ActorName(json.value("ActorName", "")),
-		ActorType(getActorTypeFromValue(json.value("ActorType", 0))),
-		KillType(getKillTypeFromValue(json.value("KillType", 0))),
-		KillContext(getDeathContextFromValue(json.value("KillContext", 0))),
-		KillClass(json.value("KillClass", "")),
-		Accident(json.value("Accident", false)),
-		WeaponSilenced(json.value("WeaponSilenced", false)),
-		Explosive(json.value("Explosive", false)),
-		ExplosionType(json.value("ExplosionType", 0)),
-		Projectile(json.value("Projectile", false)),
-		Sniper(json.value("Sniper", false)),
-		IsHeadshot(json.value("IsHeadshot", false)),
-		IsTarget(json.value("IsTarget", false)),
-		ThroughWall(json.value("ThroughWall", false)),
-		BodyPartId(json.value("BodyPartId", -1)),
-		TotalDamage(json.value("TotalDamage", 0)),
-		IsMoving(json.value("IsMoving", false)),
-		RoomId(json.value("RoomId", -1)),
-		ActorPosition(json.value("ActorPosition", "")),
-		HeroPosition(json.value("HeroPosition", "")),
-		DamageEvents(json["DamageEvents"].get<std::vector<std::string>>()),
-		PlayerId(json.value("PlayerId", -1)),
-		OutfitRepositoryId(json.value("OutfitRepositoryId", "")),
-		SetPieceId(json.value("SetPieceId", "")),
-		SetPieceType(json.value("SetPieceType", "")),
-		OutfitIsHitmanSuit(json.value("OutfitIsHitmanSuit", false)),
-		KillMethodBroad(json.value("KillMethodBroad", "")),
-		KillMethodStrict(json.value("KillMethodStrict", "")),
-		EvergreenRarity(json.value("EvergreenRarity", -1))
-	{
-		auto& history = json["History"];
-		if (history.is_array()) {
-			for (auto& historyIt : history)
-				this->History.emplace_back(historyIt);
-		}
+	std::pmr::string RepositoryId;
+	uint32_t ActorId = 0;
+	std::pmr::string ActorName;
+	EActorType ActorType = getActorTypeFromValue(0);
+	EKillType KillType = getKillTypeFromValue(0);
+	EDeathContext KillContext = getDeathContextFromValue(0);
+	eKillClass KillClass = eKillClass::None;
+	bool Accident = false;
+	bool WeaponSilenced = false;
+	bool Explosive = false;
+	int ExplosionType = 0;
+	bool Projectile = false;
+	bool Sniper = false;
+	bool IsHeadshot = false;
+	bool IsTarget = false;
+	bool ThroughWall = false;
+	int BodyPartId = -1;
+	double TotalDamage = 0;
+	bool IsMoving = false;
+	int RoomId = -1;
+	std::pmr::string ActorPosition;
+	std::pmr::string HeroPosition;
+	std::pmr::vector<eDamageEvent> DamageEvents;
+	int PlayerId = -1;
+	std::pmr::string OutfitRepositoryId;
+	std::pmr::string SetPieceId;
+	std::pmr::string SetPieceType;
+	bool OutfitIsHitmanSuit = false;
+	eKillMethodBroad KillMethodBroad = eKillMethodBroad::None;
+	eKillMethodStrict KillMethodStrict = eKillMethodStrict::None;
+	int EvergreenRarity = -1;
+	std::pmr::vector<DamageHistoryEventValue> History;
+
+	PacifyEventValue() = default;
+	PacifyEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	auto operator==(const PacifyEventValue&) const -> bool = default;
+
+	static constexpr auto fields() {
+		using T = PacifyEventValue;
+		return std::tuple{
+			eventField("RepositoryId", &T::RepositoryId),
+			eventField("ActorId", &T::ActorId),
+			eventField("ActorName", &T::ActorName),
+			eventField("ActorType", &T::ActorType, &getActorTypeFromValue),
+			eventField("KillType", &T::KillType, &getKillTypeFromValue),
+			eventField("KillContext", &T::KillContext, &getDeathContextFromValue),
+			eventField("KillClass", &T::KillClass, &getKillClassFromString),
+			eventField("Accident", &T::Accident),
+			eventField("WeaponSilenced", &T::WeaponSilenced),
+			eventField("Explosive", &T::Explosive),
+			eventField("ExplosionType", &T::ExplosionType),
+			eventField("Projectile", &T::Projectile),
+			eventField("Sniper", &T::Sniper),
+			eventField("IsHeadshot", &T::IsHeadshot),
+			eventField("IsTarget", &T::IsTarget),
+			eventField("ThroughWall", &T::ThroughWall),
+			eventField("BodyPartId", &T::BodyPartId),
+			eventField("TotalDamage", &T::TotalDamage),
+			eventField("IsMoving", &T::IsMoving),
+			eventField("RoomId", &T::RoomId),
+			eventField("ActorPosition", &T::ActorPosition),
+			eventField("HeroPosition", &T::HeroPosition),
+			eventField("DamageEvents", &T::DamageEvents, &getDamageEventFromString),
+			eventField("PlayerId", &T::PlayerId),
+			eventField("OutfitRepositoryId", &T::OutfitRepositoryId),
+			eventField("SetPieceId", &T::SetPieceId),
+			eventField("SetPieceType", &T::SetPieceType),
+			eventField("OutfitIsHitmanSuit", &T::OutfitIsHitmanSuit),
+			eventField("KillMethodBroad", &T::KillMethodBroad, &getKillMethodBroadFromString),
+			eventField("KillMethodStrict", &T::KillMethodStrict, &getKillMethodStrictFromString),
+			eventField("EvergreenRarity", &T::EvergreenRarity),
+			eventField("History", &T::History),
+		};
 	}
 };
 
 struct KillEventValue : PacifyEventValue {
-	std::string KillItemRepositoryId;
-	std::string KillItemInstanceId;
-	std::string KillItemCategory;
-
-	KillEventValue(const nlohmann::json& json) : PacifyEventValue(json),
-		KillItemRepositoryId(json.value("KillItemRepositoryId", "")),
-		KillItemInstanceId(json.value("KillItemInstanceId", "")),
-		KillItemCategory(json.value("KillItemCategory", ""))
-	{
+	std::pmr::string KillItemRepositoryId;
+	std::pmr::string KillItemInstanceId;
+	eKillItemCategory KillItemCategory = eKillItemCategory::None;
+
+	KillEventValue() = default;
+	KillEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	auto operator==(const KillEventValue&) const -> bool = default;
+
+	static constexpr auto fields() {
+		return std::tuple_cat(PacifyEventValue::fields(), std::tuple{
+			eventField("KillItemRepositoryId", &KillEventValue::KillItemRepositoryId),
+			eventField("KillItemInstanceId", &KillEventValue::KillItemInstanceId),
+			eventField("KillItemCategory", &KillEventValue::KillItemCategory, &getKillItemCategoryFromString),
+		});
 	}
 };
 
 struct VoidEventValue {
-	VoidEventValue(const nlohmann::json& json) {}
+	VoidEventValue() = default;
+	VoidEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = nullptr) {}
+};
+
+template<>
+struct EventValueWire<VoidEventValue> {
+	using Type = void;
 };
 
 struct StringEventValue {
-	std::string value;
+	std::pmr::string value;
 
-	StringEventValue(const nlohmann::json& json) : value(json.get<std::string>())
+	StringEventValue(std::pmr::string&& value) : value(std::move(value))
 	{ }
+
+	StringEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+		value(json.get_ref<const std::string&>(), resource)
+	{ }
+};
+
+template<>
+struct EventValueWire<StringEventValue> {
+	using Type = std::pmr::string;
 };
 
+// Not decoded at all, listeners that want the value can get it from ServerEvent::toJson.
 struct RawEventValue {
-	const nlohmann::json value;
+	RawEventValue() = default;
+	RawEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = nullptr) {}
+};
 
-	RawEventValue(const nlohmann::json& json) : value(json)
-	{ }
+template<>
+struct EventValueWire<RawEventValue> {
+	using Type = void;
 };
 
 struct StringArrayEventValue {
-	std::vector<std::string> value;
+	std::pmr::vector<std::pmr::string> value;
 
-	StringArrayEventValue(const nlohmann::json& json) {
+	StringArrayEventValue(std::pmr::vector<std::pmr::string>&& value) : value(std::move(value))
+	{ }
+
+	StringArrayEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+		value(resource)
+	{
 		if (!json.is_array()) return;
 		for (auto& v : json) {
-			this->value.emplace_back(v.get<std::string>());
+			this->value.emplace_back(v.get_ref<const std::string&>());
 		}
 	}
 };
 
+template<>
+struct EventValueWire<StringArrayEventValue> {
+	using Type = std::pmr::vector<std::pmr::string>;
+};
+
 struct TakedownCleannessEventValue {
-	std::string RepositoryId;
-	bool IsTarget;
+	std::pmr::string RepositoryId;
+	bool IsTarget = false;
 
-	TakedownCleannessEventValue(const nlohmann::json& json) :
-		RepositoryId(json.value("RepositoryId", "")),
-		IsTarget(json.value("IsTarget", false))
-	{ }
+	TakedownCleannessEventValue() = default;
+	TakedownCleannessEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("RepositoryId", &TakedownCleannessEventValue::RepositoryId),
+			eventField("IsTarget", &TakedownCleannessEventValue::IsTarget),
+		};
+	}
 };
 
 struct ActorIdentityEventValue {
-	unsigned ActorId;
-	std::string RepositoryId;
-	std::string ActorName;
-
-	ActorIdentityEventValue(const nlohmann::json& json) :
-		ActorId(json.value("ActorId", 0)),
-		RepositoryId(json.value("RepositoryId", "")),
-		ActorName(json.value("ActorName", ""))
-	{ }
+	unsigned ActorId = 0;
+	std::pmr::string RepositoryId;
+	std::pmr::string ActorName;
+
+	ActorIdentityEventValue() = default;
+	ActorIdentityEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("ActorId", &ActorIdentityEventValue::ActorId),
+			eventField("RepositoryId", &ActorIdentityEventValue::RepositoryId),
+			eventField("ActorName", &ActorIdentityEventValue::ActorName),
+		};
+	}
 };
 
 struct BodyEventValue {
-	std::string RepositoryId;
-	bool IsCrowdActor;
+	std::pmr::string RepositoryId;
+	bool IsCrowdActor = false;
 
-	BodyEventValue(const nlohmann::json& json) :
-		RepositoryId(json.value("RepositoryId", "")),
-		IsCrowdActor(json.value("IsCrowdActor", false))
-	{ }
+	BodyEventValue() = default;
+	BodyEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("RepositoryId", &BodyEventValue::RepositoryId),
+			eventField("IsCrowdActor", &BodyEventValue::IsCrowdActor),
+		};
+	}
 };
 
 struct BodyKillInfoEventValue : BodyEventValue {
-	EDeathContext DeathContext;
-	EDeathType DeathType;
+	EDeathContext DeathContext = getDeathContextFromValue(0);
+	EDeathType DeathType = getDeathTypeFromValue(0);
 
-	BodyKillInfoEventValue(const nlohmann::json& json) :
-		BodyEventValue(json),
-		DeathContext(getDeathContextFromValue(json.value("DeathContext", 0))),
-		DeathType(getDeathTypeFromValue(json.value("DeathType", 0)))
-	{ }
+	BodyKillInfoEventValue() = default;
+	BodyKillInfoEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	static constexpr auto fields() {
+		return std::tuple_cat(BodyEventValue::fields(), std::tuple{
+			eventField("DeathContext", &BodyKillInfoEventValue::DeathContext, &getDeathContextFromValue),
+			eventField("DeathType", &BodyKillInfoEventValue::DeathType, &getDeathTypeFromValue),
+		});
+	}
 };
 
 struct ItemEventValue {
-	std::string RepositoryId;
-	std::string ItemType;
-	std::string ItemName;
+	std::pmr::string RepositoryId;
+	std::pmr::string ItemType;
+	std::pmr::string ItemName;
 	//std::vector<std::string> OnlineTraits;
 	//std::string ActionRewardType;
 
-	ItemEventValue(const nlohmann::json& json) {
-		ItemName = json.value("ItemName", "");
-		ItemType = json.value("ItemType", "");
-		RepositoryId = json.value("RepositoryId", "");
+	ItemEventValue() = default;
+	ItemEventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+		decodeEventFields(json, *this, resource);
+	}
+
+	static constexpr auto fields() {
+		return std::tuple{
+			eventField("RepositoryId", &ItemEventValue::RepositoryId),
+			eventField("ItemType", &ItemEventValue::ItemType),
+			eventField("ItemName", &ItemEventValue::ItemName),
+		};
 	}
 };
 
@@ -237,38 +338,36 @@ struct Event<Events::ContractStart> {
 	static auto constexpr Name = "ContractStart";
 
 	struct EventValue {
-		std::vector<LoadoutItemEventValue> Loadout;
-		std::string Disguise;
-		std::string LocationId;
-		MissionType ContractType;
-		std::vector<GameChanger> GameChangers;
-		int DifficultyLevel;
-		bool IsVR;
-		bool IsHitmanSuit;
-		std::string SelectedCharacterId;
-		int EvergreenSeed;
-		int EvergreenDifficulty;
-
-		EventValue(const nlohmann::json& value) {
-			auto& loadout = value["Loadout"];
-			for (auto const& ld : loadout)
-			{
-				LoadoutItemEventValue loadoutItem;
-				loadoutItem.RepositoryId = ld.value("RepositoryId", "");
-				loadoutItem.InstanceId = ld.value("RepositoryId", "");
-				loadoutItem.OnlineTraits = ld["OnlineTraits"].get<std::vector<std::string>>();
-				loadoutItem.Category = nullptr;
-				Loadout.emplace_back(loadoutItem);
-			}
-			Disguise = value.value("Disguise", "");
-			LocationId = value.value("LocationId", "");
-			ContractType = *getMissionTypeFromString(value.value("ContractType", ""));
-			DifficultyLevel = value.value<int>("DifficultyLevel", -1);
-			IsVR = value.value<bool>("IsVR", false);
-			IsHitmanSuit = value.value<bool>("IsHitmanSuit", false);
-			SelectedCharacterId = value.value("SelectedCharacterId", "");
-			EvergreenSeed = value.value("EvergreenSeed", 0);
-			EvergreenDifficulty = value.value("EvergreenDifficulty", 0);
+		std::pmr::vector<LoadoutItemEventValue> Loadout;
+		std::pmr::string Disguise;
+		std::pmr::string LocationId;
+		MissionType ContractType = MissionType::Mission;
+		std::pmr::vector<GameChanger> GameChangers;
+		int DifficultyLevel = -1;
+		bool IsVR = false;
+		bool IsHitmanSuit = false;
+		std::pmr::string SelectedCharacterId;
+		int EvergreenSeed = 0;
+		int EvergreenDifficulty = 0;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("Loadout", &EventValue::Loadout),
+				eventField("Disguise", &EventValue::Disguise),
+				eventField("LocationId", &EventValue::LocationId),
+				eventField("ContractType", &EventValue::ContractType, &getMissionTypeFromString),
+				eventField("DifficultyLevel", &EventValue::DifficultyLevel),
+				eventField("IsVR", &EventValue::IsVR),
+				eventField("IsHitmanSuit", &EventValue::IsHitmanSuit),
+				eventField("SelectedCharacterId", &EventValue::SelectedCharacterId),
+				eventField("EvergreenSeed", &EventValue::EvergreenSeed),
+				eventField("EvergreenDifficulty", &EventValue::EvergreenDifficulty),
+			};
 		}
 	};
 };
@@ -284,15 +383,22 @@ struct Event<Events::ContractEnd> {
 	static auto constexpr Name = "ContractEnd";
 	struct EventValue {
 		//std::string ContractType;
-		MissionType ContractType;
-		int GameMode;
-		int EngineMode;
-
-		EventValue(const nlohmann::json& json) :
-			ContractType(*getMissionTypeFromString(json.value("ContractType", ""))),
-			GameMode(json.value("GameMode", 0)),
-			EngineMode(json.value("EngineMode", 0))
-		{}
+		MissionType ContractType = MissionType::Mission;
+		int GameMode = 0;
+		int EngineMode = 0;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("ContractType", &EventValue::ContractType, &getMissionTypeFromString),
+				eventField("GameMode", &EventValue::GameMode),
+				eventField("EngineMode", &EventValue::EngineMode),
+			};
+		}
 	};
 };
 
@@ -300,11 +406,18 @@ template<>
 struct Event<Events::HeroSpawn_Location> {
 	static auto constexpr Name = "HeroSpawn_Location";
 	struct EventValue {
-		std::string RepositoryId;
+		std::pmr::string RepositoryId;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
 
-		EventValue(const nlohmann::json& json) :
-			RepositoryId(json.value("RepositoryId", ""))
-		{}
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("RepositoryId", &EventValue::RepositoryId),
+			};
+		}
 	};
 };
 
@@ -324,23 +437,33 @@ template<>
 struct Event<Events::setpieces> {
 	static auto constexpr Name = "setpieces";
 	struct EventValue {
-		std::string RepositoryId;
-		std::string name_metricvalue;
-		std::string setpieceHelper_metricvalue;
-		std::string setpieceType_metricvalue;
-		std::string toolUsed_metricvalue;
-		std::string Item_triggered_metricvalue;
-		SVector3 Position;
-
-		EventValue(const nlohmann::json& json) :
-			RepositoryId(json.value("RepositoryId", "")),
-			name_metricvalue(json.value("name_metricvalue", "")),
-			setpieceHelper_metricvalue(json.value("setpieceHelper_metricvalue", "")),
-			setpieceType_metricvalue(json.value("setpieceType_metricvalue", "")),
-			toolUsed_metricvalue(json.value("toolUsed_metricvalue", "")),
-			Item_triggered_metricvalue(json.value("Item_triggered_metricvalue", "")),
-			Position(json.value("x", 0.0), json.value("y", 0.0), json.value("z", 0.0))
-		{ }
+		std::pmr::string RepositoryId;
+		std::pmr::string name_metricvalue;
+		std::pmr::string setpieceHelper_metricvalue;
+		std::pmr::string setpieceType_metricvalue;
+		std::pmr::string toolUsed_metricvalue;
+		std::pmr::string Item_triggered_metricvalue;
+		SVector3 Position{};
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("RepositoryId", &EventValue::RepositoryId),
+				eventField("name_metricvalue", &EventValue::name_metricvalue),
+				eventField("setpieceHelper_metricvalue", &EventValue::setpieceHelper_metricvalue),
+				eventField("setpieceType_metricvalue", &EventValue::setpieceType_metricvalue),
+				eventField("toolUsed_metricvalue", &EventValue::toolUsed_metricvalue),
+				eventField("Item_triggered_metricvalue", &EventValue::Item_triggered_metricvalue),
+				// The position is sent as separate top-level coordinates.
+				eventFieldSetter("x", +[](EventValue& v, float x) { v.Position.x = x; }),
+				eventFieldSetter("y", +[](EventValue& v, float y) { v.Position.y = y; }),
+				eventFieldSetter("z", +[](EventValue& v, float z) { v.Position.z = z; }),
+			};
+		}
 	};
 };
 
@@ -348,10 +471,17 @@ template<>
 struct Event<Events::AddSyndicateTarget> {
 	static auto constexpr Name = "AddSyndicateTarget";
 	struct EventValue {
-		std::string repoID;
+		std::pmr::string repoID;
 
-		EventValue(const nlohmann::json& json) {
-			repoID = json.value("repoID", "");
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("repoID", &EventValue::repoID),
+			};
 		}
 	};
 };
@@ -380,6 +510,12 @@ struct Event<Events::ItemDropped> {
 	using EventValue = ItemEventValue;
 };
 
+template<>
+struct Event<Events::ItemDestroyed> {
+	static auto constexpr Name = "ItemDestroyed";
+	using EventValue = VoidEventValue;
+};
+
 template<>
 struct Event<Events::ItemThrown> {
 	static auto constexpr Name = "ItemThrown";
@@ -402,25 +538,34 @@ template<>
 struct Event<Events::Actorsick> {
 	static auto constexpr Name = "Actorsick";
 	struct EventValue {
-		SVector3 ActorPosition;
-		unsigned ActorId;
-		std::string ActorName;
-		std::string actor_R_ID;
-		bool IsTarget;
-		std::string item_R_ID;
-		std::string setpiece_R_ID;
-		EActorType ActorType;
-
-		EventValue(const nlohmann::json& json) :
-			ActorPosition(json.value("x", 0.0), json.value("y", 0.0), json.value("z", 0.0)),
-			ActorId(json.value("ActorId", 0)),
-			ActorName(json.value("ActorName", "")),
-			actor_R_ID(json.value("actor_R_ID", "")),
-			IsTarget(json.value("IsTarget", false)),
-			item_R_ID(json.value("item_R_ID", "")),
-			setpiece_R_ID(json.value("setpiece_R_ID", "")),
-			ActorType(getActorTypeFromValue(json.value("ActorType", -1)))
-		{ }
+		SVector3 ActorPosition{};
+		unsigned ActorId = 0;
+		std::pmr::string ActorName;
+		std::pmr::string actor_R_ID;
+		bool IsTarget = false;
+		std::pmr::string item_R_ID;
+		std::pmr::string setpiece_R_ID;
+		EActorType ActorType = getActorTypeFromValue(-1);
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventFieldSetter("x", +[](EventValue& v, float x) { v.ActorPosition.x = x; }),
+				eventFieldSetter("y", +[](EventValue& v, float y) { v.ActorPosition.y = y; }),
+				eventFieldSetter("z", +[](EventValue& v, float z) { v.ActorPosition.z = z; }),
+				eventField("ActorId", &EventValue::ActorId),
+				eventField("ActorName", &EventValue::ActorName),
+				eventField("actor_R_ID", &EventValue::actor_R_ID),
+				eventField("IsTarget", &EventValue::IsTarget),
+				eventField("item_R_ID", &EventValue::item_R_ID),
+				eventField("setpiece_R_ID", &EventValue::setpiece_R_ID),
+				eventField("ActorType", &EventValue::ActorType, &getActorTypeFromValue),
+			};
+		}
 	};
 };
 
@@ -440,21 +585,28 @@ template<>
 struct Event<Events::Dart_Hit> {
 	static auto constexpr Name = "Dart_Hit";
 	struct EventValue {
-		std::string RepositoryId;
-		EActorType ActorType;
-		bool IsTarget;
-		bool Blind;
-		bool Sedative;
-		bool Sick;
-
-		EventValue(const nlohmann::json& json) :
-			RepositoryId(json.value("RepositoryId", "")),
-			ActorType(getActorTypeFromValue(json.value("ActorType", -1))),
-			IsTarget(json.value("IsTarget", false)),
-			Blind(json.find("Blind") != json.end()),
-			Sedative(json.find("Sedative") != json.end()),
-			Sick(json.find("Sick") != json.end())
-		{ }
+		std::pmr::string RepositoryId;
+		EActorType ActorType = getActorTypeFromValue(-1);
+		bool IsTarget = false;
+		bool Blind = false;
+		bool Sedative = false;
+		bool Sick = false;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("RepositoryId", &EventValue::RepositoryId),
+				eventField("ActorType", &EventValue::ActorType, &getActorTypeFromValue),
+				eventField("IsTarget", &EventValue::IsTarget),
+				eventFieldPresence("Blind", &EventValue::Blind),
+				eventFieldPresence("Sedative", &EventValue::Sedative),
+				eventFieldPresence("Sick", &EventValue::Sick),
+			};
+		}
 	};
 };
 
@@ -462,13 +614,20 @@ template<>
 struct Event<Events::Trespassing> {
 	static auto constexpr Name = "Trespassing";
 	struct EventValue {
-		bool IsTrespassing;
-		int RoomId;
+		bool IsTrespassing = false;
+		int RoomId = -1;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
 
-		EventValue(const nlohmann::json& json) :
-			IsTrespassing(json.value("IsTrespassing", false)),
-			RoomId(json.value("RoomId", -1))
-		{ }
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("IsTrespassing", &EventValue::IsTrespassing),
+				eventField("RoomId", &EventValue::RoomId),
+			};
+		}
 	};
 };
 
@@ -476,15 +635,22 @@ template<>
 struct Event<Events::SecuritySystemRecorder> {
 	static auto constexpr Name = "SecuritySystemRecorder";
 	struct EventValue {
-		SecuritySystemRecorderEvent event;
-		unsigned camera;
-		unsigned recorder;
-
-		EventValue(const nlohmann::json& json) :
-			event(getSecuritySystemRecorderEventFromString(json.value("event", ""))),
-			camera(json.value("camera", 0)),
-			recorder(json.value("recorder", 0))
-		{ }
+		SecuritySystemRecorderEvent event = SecuritySystemRecorderEvent::Undefined;
+		unsigned camera = 0;
+		unsigned recorder = 0;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("event", &EventValue::event, &getSecuritySystemRecorderEventFromString),
+				eventField("camera", &EventValue::camera),
+				eventField("recorder", &EventValue::recorder),
+			};
+		}
 	};
 };
 
@@ -524,8 +690,16 @@ struct Event<Events::AccidentBodyFound> {
 	struct EventValue {
 		BodyKillInfoEventValue DeadBody;
 
-		EventValue(const nlohmann::json& json) : DeadBody(json["DeadBody"])
-		{}
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("DeadBody", &EventValue::DeadBody),
+			};
+		}
 	};
 };
 
@@ -535,8 +709,16 @@ struct Event<Events::BodyFound> {
 	struct EventValue {
 		BodyKillInfoEventValue DeadBody;
 
-		EventValue(const nlohmann::json& json) : DeadBody(json["DeadBody"])
-		{}
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("DeadBody", &EventValue::DeadBody),
+			};
+		}
 	};
 };
 
@@ -551,13 +733,21 @@ struct Event<Events::MurderedBodySeen> {
 	static auto constexpr Name = "MurderedBodySeen";
 	struct EventValue {
 		BodyEventValue DeadBody;
-		std::string Witness;
-		bool IsWitnessTarget;
+		std::pmr::string Witness;
+		bool IsWitnessTarget = false;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
 
-		EventValue(const nlohmann::json& json) : DeadBody(json["DeadBody"]),
-			Witness(json.value("Witness", "")),
-			IsWitnessTarget(json.value("IsWitnessTarget", false))
-		{}
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("DeadBody", &EventValue::DeadBody),
+				eventField("Witness", &EventValue::Witness),
+				eventField("IsWitnessTarget", &EventValue::IsWitnessTarget),
+			};
+		}
 	};
 };
 
@@ -625,12 +815,20 @@ template<>
 struct Event<Events::ShotsFired> {
 	static auto constexpr Name = "ShotsFired";
 	struct EventValue {
-		int Split;
-		int Total;
+		int Split = 0;
+		int Total = 0;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
 
-		EventValue(const nlohmann::json& json) : Split(json["Split"].value("", 0)),
-			Total(json.value("Total", 0))
-		{}
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("Split", &EventValue::Split),
+				eventField("Total", &EventValue::Total),
+			};
+		}
 	};
 };
 
@@ -686,17 +884,22 @@ template<>
 struct Event<Events::AmbientChanged> {
 	static auto constexpr Name = "AmbientChanged";
 	struct EventValue {
-		EGameTension PreviousAmbientValue;
-		EGameTension AmbientValue;
+		EGameTension PreviousAmbientValue = getGameTensionFromValue(0);
+		EGameTension AmbientValue = getGameTensionFromValue(0);
 		//std::string PreviousAmbient;
 		//std::string Ambient;
 
-		EventValue(const nlohmann::json& json) :
-			PreviousAmbientValue(getGameTensionFromValue(json.value("PreviousAmbientValue", 0))),
-			AmbientValue(getGameTensionFromValue(json.value("PreviousAmbientValue", 0)))
-			//PreviousAmbient(json.value("PreviousAmbient", "")),
-			//Ambient(json.value("Ambient", "")),
-		{}
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("PreviousAmbientValue", &EventValue::PreviousAmbientValue, &getGameTensionFromValue),
+				eventField("AmbientValue", &EventValue::AmbientValue, &getGameTensionFromValue),
+			};
+		}
 	};
 };
 
@@ -704,11 +907,18 @@ template<>
 struct Event<Events::HoldingIllegalWeapon> {
 	static auto constexpr Name = "HoldingIllegalWeapon";
 	struct EventValue {
-		bool IsHoldingIllegalWeapon;
+		bool IsHoldingIllegalWeapon = false;
 
-		EventValue(const nlohmann::json& json) :
-			IsHoldingIllegalWeapon(json.value("IsHoldingIllegalWeapon", false))
-		{}
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("IsHoldingIllegalWeapon", &EventValue::IsHoldingIllegalWeapon),
+			};
+		}
 	};
 };
 
@@ -729,8 +939,20 @@ struct Event<Events::OpportunityEvents> {
 	static auto constexpr Name = "OpportunityEvents";
 
 	struct EventValue {
-		std::string RepositoryId;
-		std::string Event;
+		std::pmr::string RepositoryId;
+		std::pmr::string Event;
+
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("RepositoryId", &EventValue::RepositoryId),
+				eventField("Event", &EventValue::Event),
+			};
+		}
 	};
 };
 
@@ -739,16 +961,43 @@ struct Event<Events::Level_Setup_Events> {
 	static auto constexpr Name = "Level_Setup_Events";
 
 	struct EventValue {
-		std::string Contract_Name_metricvalue;
-		std::string Location_MetricValue;
-		std::string Event_metricvalue;
+		std::pmr::string Contract_Name_metricvalue;
+		std::pmr::string Location_MetricValue;
+		std::pmr::string Event_metricvalue;
 
-		EventValue(const nlohmann::json& json) :
-			Contract_Name_metricvalue(json.value("Contract_Name_metricvalue", "")),
-			Location_MetricValue(json.value("Location_MetricValue", "")),
-			Event_metricvalue(json.value("Event_metricvalue", ""))
-			//Ambient(json.value("Ambient", "")),
-		{
+		EventValue() = default;
+		EventValue(const nlohmann::json& json, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+			decodeEventFields(json, *this, resource);
+		}
+
+		static constexpr auto fields() {
+			return std::tuple{
+				eventField("Contract_Name_metricvalue", &EventValue::Contract_Name_metricvalue),
+				eventField("Location_MetricValue", &EventValue::Location_MetricValue),
+				eventField("Event_metricvalue", &EventValue::Event_metricvalue),
+			};
 		}
 	};
 };
+
+// Name of every event indexed by its ID, taken from the Event<> specializations above.
+inline constexpr auto eventNames = []<size_t... Indices>(std::index_sequence<Indices...>) {
+	return std::array<std::string_view, numEvents>{Event<static_cast<Events>(Indices)>::Name...};
+}(std::make_index_sequence<numEvents>{});
+
+inline constexpr auto eventNameTable = KeywordTable<Events, numEvents>{[]{
+	std::array<KeywordTableView<Events>::Entry, numEvents> entries;
+	for (size_t i = 0; i < entries.size(); ++i)
+		entries[i] = {eventNames[i], static_cast<Events>(i)};
+	return entries;
+}()};
+
+constexpr auto getEventName(Events ev) -> std::string_view {
+	return eventNames[static_cast<size_t>(ev)];
+}
+
+constexpr auto getEventByName(std::string_view name) -> std::optional<Events> {
+	auto ev = eventNameTable.findExact(name);
+	if (ev) return *ev;
+	return std::nullopt;
+}
@@ -9,7 +9,7 @@ public:
 	RouletteGeneratorException(std::string_view msg) : msg(std::format("Roulette Generator Error - {}", msg))
 	{}
 
-	auto what() const -> char const* override {
+	auto what() const noexcept -> char const* override {
 		return msg.c_str();
 	}
 
@@ -0,0 +1,125 @@
+#include "FrameScheduler.h"
+#include <algorithm>
+#include <cassert>
+#include <bit>
+
+auto FrameTaskTimings::record(std::chrono::microseconds duration) -> void {
+	auto const us = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+	auto const bucket = std::min<size_t>(std::bit_width(us), numBuckets - 1);
+	++this->buckets[bucket];
+	++this->runs;
+	this->total += duration;
+	this->max = std::max(this->max, duration);
+}
+
+auto FrameTaskTimings::percentile(double fraction) const -> std::chrono::microseconds {
+	if (!this->runs) return {};
+
+	auto const wanted = static_cast<uint64_t>(fraction * this->runs);
+	uint64_t counted = 0;
+	for (size_t i = 0; i < numBuckets - 1; ++i) {
+		counted += this->buckets[i];
+		if (counted > wanted) return std::chrono::microseconds(uint64_t{1} << i);
+	}
+	return this->max;
+}
+
+auto FrameTaskTimings::mean() const -> std::chrono::microseconds {
+	return this->runs ? this->total / static_cast<int64_t>(this->runs) : std::chrono::microseconds{};
+}
+
+auto FrameScheduler::addPeriodic(std::string name, eFrameTaskPriority priority, Clock::duration period, std::function<void()> func, Clock::duration maxDelay) -> TaskId {
+	return this->add({
+		.name = std::move(name),
+		.priority = priority,
+		.period = period,
+		.maxDelay = maxDelay,
+		.func = std::move(func),
+		.dueSince = {},
+		.periodic = true,
+		.due = true,
+		.timings = {},
+	});
+}
+
+auto FrameScheduler::addOnRequest(std::string name, eFrameTaskPriority priority, std::function<void()> func, Clock::duration maxDelay) -> TaskId {
+	return this->add({
+		.name = std::move(name),
+		.priority = priority,
+		.period = {},
+		.maxDelay = maxDelay,
+		.func = std::move(func),
+		.dueSince = {},
+		.periodic = false,
+		.due = false,
+		.timings = {},
+	});
+}
+
+auto FrameScheduler::add(Task task) -> TaskId {
+	auto const id = this->tasks.size();
+	assert(id < maxTasks);
+	this->tasks.push_back(std::move(task));
+
+	// Keep the run order sorted by priority, after earlier tasks of the same priority.
+	auto it = std::upper_bound(this->order.begin(), this->order.end(), this->tasks[id].priority, [this](eFrameTaskPriority priority, TaskId other) {
+		return priority < this->tasks[other].priority;
+	});
+	this->order.insert(it, id);
+	return id;
+}
+
+auto FrameScheduler::request(TaskId id) -> void {
+	this->requested.fetch_or(uint64_t{1} << id);
+}
+
+auto FrameScheduler::flush(TaskId id) -> void {
+	auto const bit = uint64_t{1} << id;
+	this->takeRequests(this->requested.fetch_and(~bit) & bit, Clock::now());
+
+	auto& task = this->tasks[id];
+	if (task.due) this->run(task);
+}
+
+auto FrameScheduler::takeRequests(uint64_t mask, Clock::time_point now) -> void {
+	for (; mask; mask &= mask - 1) {
+		auto& task = this->tasks[std::countr_zero(mask)];
+		if (task.due) continue;
+		task.due = true;
+		task.dueSince = now;
+	}
+}
+
+auto FrameScheduler::runFrame(Clock::time_point now) -> void {
+	auto const frameStart = Clock::now();
+	this->takeRequests(this->requested.exchange(0), now);
+
+	for (auto id : this->order) {
+		auto& task = this->tasks[id];
+
+		if (task.periodic && !task.due && now - task.dueSince >= task.period) {
+			task.due = true;
+			task.dueSince += task.period;
+			// Don't try to catch up on periods missed, just run once.
+			if (now - task.dueSince >= task.period) task.dueSince = now;
+		}
+		if (!task.due) continue;
+
+		auto const overBudget = Clock::now() - frameStart >= this->budget;
+		if (overBudget && task.priority != eFrameTaskPriority::Urgent && now - task.dueSince < task.maxDelay) {
+			++task.timings.deferrals;
+			continue;
+		}
+
+		this->run(task);
+	}
+}
+
+auto FrameScheduler::run(Task& task) -> void {
+	// Clear first so the task can request itself again.
+	task.due = false;
+
+	auto const start = Clock::now();
+	task.func();
+	task.timings.record(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start));
+}
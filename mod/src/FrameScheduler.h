@@ -0,0 +1,97 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class eFrameTaskPriority {
+	// Runs whenever it's due, regardless of the frame's budget.
+	Urgent,
+	// Runs when due, while the frame's budget lasts.
+	Normal,
+	// Runs after the due Normal tasks, with what's left of the budget.
+	Deferred,
+};
+
+// How long a task's runs took, counted in power of two buckets of microseconds.
+struct FrameTaskTimings {
+	// Bucket 0 counts runs under 1us, bucket n runs of 2^(n-1) to 2^n us, and the last bucket anything longer.
+	static constexpr size_t numBuckets = 16;
+
+	std::array<uint32_t, numBuckets> buckets = {};
+	uint64_t runs = 0;
+	// Times the task was due but put off to a later frame for lack of budget.
+	uint64_t deferrals = 0;
+	std::chrono::microseconds total = {};
+	std::chrono::microseconds max = {};
+
+	auto record(std::chrono::microseconds duration) -> void;
+	// Upper bound of the bucket the given fraction of runs fall within.
+	auto percentile(double fraction) const -> std::chrono::microseconds;
+	auto mean() const -> std::chrono::microseconds;
+};
+
+// Runs the mod's per-frame work cooperatively within a time budget. Tasks run in order of priority, then the order
+// they were added in. Once the budget is spent, the remaining Normal and Deferred tasks wait for a later frame, unless
+// they've been waiting longer than their maximum delay. Tasks can't be interrupted, so one that runs long still costs
+// the frame its time. Only request() is thread safe, so tasks can be requested from any thread. Everything else has to
+// stay on one thread at a time, Croupier holds its state mutex for it.
+class FrameScheduler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+	using TaskId = size_t;
+
+	static constexpr auto defaultBudget = std::chrono::microseconds(500);
+	static constexpr auto defaultMaxDelay = std::chrono::seconds(1);
+	// Requests are kept as bits of one atomic word.
+	static constexpr size_t maxTasks = 64;
+
+	struct Task {
+		std::string name;
+		eFrameTaskPriority priority = eFrameTaskPriority::Normal;
+		// Zero runs the task every frame. Unused for tasks run on request.
+		Clock::duration period = {};
+		Clock::duration maxDelay = defaultMaxDelay;
+		std::function<void()> func;
+		Clock::time_point dueSince = {};
+		bool periodic = true;
+		bool due = true;
+		FrameTaskTimings timings;
+	};
+
+	FrameScheduler(std::chrono::microseconds budget = defaultBudget) : budget(budget)
+	{}
+
+	// Adds a task that runs every period, or every frame if the period is zero.
+	auto addPeriodic(std::string name, eFrameTaskPriority priority, Clock::duration period, std::function<void()> func, Clock::duration maxDelay = defaultMaxDelay) -> TaskId;
+	// Adds a task that runs once after it's requested, however many times that was since it last ran.
+	auto addOnRequest(std::string name, eFrameTaskPriority priority, std::function<void()> func, Clock::duration maxDelay = defaultMaxDelay) -> TaskId;
+	// Can be called from any thread. The task is due from the next frame.
+	auto request(TaskId id) -> void;
+	// Runs a requested task immediately, e.g. before shutting down.
+	auto flush(TaskId id) -> void;
+	auto runFrame(Clock::time_point now = Clock::now()) -> void;
+
+	auto setBudget(std::chrono::microseconds budget) -> void { this->budget = budget; }
+	auto getBudget() const -> std::chrono::microseconds { return this->budget; }
+	auto getTasks() const -> std::span<const Task> { return this->tasks; }
+
+private:
+	auto add(Task task) -> TaskId;
+	auto run(Task& task) -> void;
+	// Makes the requested tasks in `mask` due, unless they already are.
+	auto takeRequests(uint64_t mask, Clock::time_point now) -> void;
+
+	std::vector<Task> tasks;
+	// A bit per task requested since the last frame took them.
+	std::atomic<uint64_t> requested = 0;
+	// Task indices in the order they run.
+	std::vector<TaskId> order;
+	std::chrono::microseconds budget;
+};
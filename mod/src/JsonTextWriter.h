@@ -0,0 +1,137 @@
+#pragma once
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include "json.hpp"
+
+// Appends the values it's given as compact JSON text, for printing an event straight from its MessagePack with
+// visitMessagePack. Non-finite numbers are written as null, like nlohmann::json's dump.
+class JsonTextWriter
+{
+public:
+	explicit JsonTextWriter(std::string& out) : out(out) { }
+
+	auto null() -> bool {
+		this->separate();
+		this->out += "null";
+		return true;
+	}
+
+	auto boolean(bool b) -> bool {
+		this->separate();
+		this->out += b ? "true" : "false";
+		return true;
+	}
+
+	auto number_integer(int64_t n) -> bool {
+		this->separate();
+		this->appendNumber(n);
+		return true;
+	}
+
+	auto number_unsigned(uint64_t n) -> bool {
+		this->separate();
+		this->appendNumber(n);
+		return true;
+	}
+
+	auto number_float(double n, const std::string&) -> bool {
+		this->separate();
+		if (!std::isfinite(n)) this->out += "null";
+		else this->appendNumber(n);
+		return true;
+	}
+
+	auto string(const std::string& str) -> bool {
+		this->separate();
+		this->appendString(str);
+		return true;
+	}
+
+	auto binary(nlohmann::json::binary_t&) -> bool {
+		this->separate();
+		this->out += "null";
+		return true;
+	}
+
+	auto key(const std::string& str) -> bool {
+		this->separate();
+		this->appendString(str);
+		this->out += ':';
+		this->afterKey = true;
+		return true;
+	}
+
+	auto start_object(size_t) -> bool {
+		this->separate();
+		this->out += '{';
+		this->first = true;
+		return true;
+	}
+
+	auto start_array(size_t) -> bool {
+		this->separate();
+		this->out += '[';
+		this->first = true;
+		return true;
+	}
+
+	auto end_object() -> bool {
+		this->out += '}';
+		this->first = false;
+		return true;
+	}
+
+	auto end_array() -> bool {
+		this->out += ']';
+		this->first = false;
+		return true;
+	}
+
+	auto parse_error(size_t, const std::string&, const nlohmann::detail::exception&) -> bool {
+		return false;
+	}
+
+private:
+	// Puts a comma before everything but the first element of a container and the value after a key.
+	auto separate() -> void {
+		if (!this->first && !this->afterKey) this->out += ',';
+		this->first = false;
+		this->afterKey = false;
+	}
+
+	template<typename T>
+	auto appendNumber(T n) -> void {
+		std::array<char, 32> buffer;
+		auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), n);
+		this->out.append(buffer.data(), result.ptr);
+	}
+
+	auto appendString(const std::string& str) -> void {
+		constexpr auto hex = "0123456789abcdef";
+		this->out += '"';
+		for (auto c : str) {
+			switch (c) {
+			case '"': this->out += "\\\""; break;
+			case '\\': this->out += "\\\\"; break;
+			case '\n': this->out += "\\n"; break;
+			case '\r': this->out += "\\r"; break;
+			case '\t': this->out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					this->out += "\\u00";
+					this->out += hex[c >> 4];
+					this->out += hex[c & 0xF];
+				}
+				else this->out += c;
+			}
+		}
+		this->out += '"';
+	}
+
+	std::string& out;
+	bool first = true;
+	bool afterKey = false;
+};
@@ -0,0 +1,193 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+// Case-insensitive (ASCII) FNV-1a hash of a keyword.
+constexpr auto hashKeyword(std::string_view keyword) -> uint64_t {
+	auto hash = uint64_t{0xCBF29CE484222325};
+	for (auto c : keyword) {
+		auto byte = static_cast<uint8_t>(c);
+		if (byte >= 'A' && byte <= 'Z') byte += 'a' - 'A';
+		hash = (hash ^ byte) * 0x100000001B3;
+	}
+	return hash;
+}
+
+constexpr auto equalsKeyword(std::string_view a, std::string_view b) -> bool {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); ++i) {
+		auto ca = static_cast<uint8_t>(a[i]);
+		auto cb = static_cast<uint8_t>(b[i]);
+		if (ca >= 'A' && ca <= 'Z') ca += 'a' - 'A';
+		if (cb >= 'A' && cb <= 'Z') cb += 'a' - 'A';
+		if (ca != cb) return false;
+	}
+	return true;
+}
+
+// Non-owning view of a KeywordTable, so tables of different sizes can be stored together.
+template<typename TValue>
+struct KeywordTableView
+{
+	using Entry = std::pair<std::string_view, TValue>;
+	static constexpr uint16_t emptySlot = 0xFFFF;
+
+	std::span<const Entry> entries;
+	std::span<const uint16_t> seeds;
+	std::span<const uint16_t> slots;
+
+	static constexpr auto slotFor(uint64_t hash, uint16_t seed, size_t numSlots) -> size_t {
+		hash ^= (seed + 1) * uint64_t{0x9E3779B97F4A7C15};
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCD;
+		hash ^= hash >> 33;
+		return static_cast<size_t>(hash & (numSlots - 1));
+	}
+
+	constexpr auto findEntry(std::string_view keyword) const -> const Entry* {
+		auto hash = hashKeyword(keyword);
+		auto slot = this->slots[slotFor(hash, this->seeds[hash % this->seeds.size()], this->slots.size())];
+		if (slot == emptySlot) return nullptr;
+		auto& entry = this->entries[slot];
+		return equalsKeyword(entry.first, keyword) ? &entry : nullptr;
+	}
+
+	constexpr auto find(std::string_view keyword) const -> const TValue* {
+		auto entry = this->findEntry(keyword);
+		return entry ? &entry->second : nullptr;
+	}
+
+	// Same as find(), but the case has to match as well.
+	constexpr auto findExact(std::string_view keyword) const -> const TValue* {
+		auto entry = this->findEntry(keyword);
+		return entry && entry->first == keyword ? &entry->second : nullptr;
+	}
+
+	constexpr auto contains(std::string_view keyword) const -> bool {
+		return this->find(keyword) != nullptr;
+	}
+
+	// Iterates every entry as written, including any later duplicates which lookups ignore.
+	constexpr auto begin() const { return this->entries.begin(); }
+	constexpr auto end() const { return this->entries.end(); }
+	constexpr auto size() const { return this->entries.size(); }
+};
+
+// Keyword -> value table with a perfect hash computed at compile time (hash and displace).
+// Keys are matched case-insensitively and the first of any duplicate keys wins.
+template<typename TValue, size_t N>
+class KeywordTable
+{
+public:
+	using View = KeywordTableView<TValue>;
+	using Entry = typename View::Entry;
+
+	static_assert(N > 0 && N < View::emptySlot, "KeywordTable size out of range");
+	static constexpr size_t numBuckets = std::max<size_t>(N / 2, 1);
+	static constexpr size_t numSlots = std::bit_ceil(N * 2);
+
+	consteval KeywordTable(const std::array<Entry, N>& tableEntries) : entries(tableEntries) {
+		std::array<uint64_t, N> hashes{};
+		std::array<size_t, numBuckets + 1> bucketStart{};
+		for (size_t i = 0; i < N; ++i) {
+			hashes[i] = hashKeyword(this->entries[i].first);
+			++bucketStart[hashes[i] % numBuckets + 1];
+		}
+
+		auto maxBucketSize = size_t{0};
+		for (size_t b = 0; b < numBuckets; ++b) {
+			maxBucketSize = std::max(maxBucketSize, bucketStart[b + 1]);
+			bucketStart[b + 1] += bucketStart[b];
+		}
+
+		// Group the entries by bucket, preserving their order so the first duplicate is kept.
+		std::array<uint16_t, N> members{};
+		auto fill = bucketStart;
+		for (size_t i = 0; i < N; ++i)
+			members[fill[hashes[i] % numBuckets]++] = static_cast<uint16_t>(i);
+
+		this->slots.fill(View::emptySlot);
+
+		// Place the largest buckets first, finding a seed that moves all of a bucket's keys into free slots.
+		std::array<uint16_t, N> keys{};
+		std::array<size_t, N> positions{};
+		for (auto size = maxBucketSize; size > 0; --size) {
+			for (size_t b = 0; b < numBuckets; ++b) {
+				if (bucketStart[b + 1] - bucketStart[b] != size) continue;
+
+				size_t numKeys = 0;
+				for (auto m = bucketStart[b]; m < bucketStart[b + 1]; ++m) {
+					auto index = members[m];
+					auto duplicate = false;
+					for (size_t k = 0; k < numKeys && !duplicate; ++k)
+						duplicate = hashes[keys[k]] == hashes[index] && equalsKeyword(this->entries[keys[k]].first, this->entries[index].first);
+					if (!duplicate) keys[numKeys++] = index;
+				}
+
+				this->placeBucket(b, keys, numKeys, hashes, positions);
+			}
+		}
+	}
+
+	constexpr auto view() const -> View {
+		return View{this->entries, this->seeds, this->slots};
+	}
+
+	constexpr operator View() const {
+		return this->view();
+	}
+
+	constexpr auto find(std::string_view keyword) const -> const TValue* {
+		return this->view().find(keyword);
+	}
+
+	constexpr auto findExact(std::string_view keyword) const -> const TValue* {
+		return this->view().findExact(keyword);
+	}
+
+	constexpr auto contains(std::string_view keyword) const -> bool {
+		return this->find(keyword) != nullptr;
+	}
+
+	constexpr auto begin() const { return this->entries.begin(); }
+	constexpr auto end() const { return this->entries.end(); }
+	constexpr auto size() const { return N; }
+
+private:
+	consteval auto placeBucket(
+		size_t bucket, const std::array<uint16_t, N>& keys, size_t numKeys,
+		const std::array<uint64_t, N>& hashes, std::array<size_t, N>& positions
+	) -> void {
+		for (uint32_t seed = 0; seed < View::emptySlot; ++seed) {
+			auto ok = true;
+			for (size_t k = 0; k < numKeys && ok; ++k) {
+				positions[k] = View::slotFor(hashes[keys[k]], static_cast<uint16_t>(seed), numSlots);
+				ok = this->slots[positions[k]] == View::emptySlot;
+				for (size_t j = 0; j < k && ok; ++j)
+					ok = positions[j] != positions[k];
+			}
+			if (!ok) continue;
+
+			this->seeds[bucket] = static_cast<uint16_t>(seed);
+			for (size_t k = 0; k < numKeys; ++k)
+				this->slots[positions[k]] = keys[k];
+			return;
+		}
+		throw std::logic_error("Failed to build perfect hash for keyword table.");
+	}
+
+	std::array<Entry, N> entries;
+	std::array<uint16_t, numBuckets> seeds{};
+	std::array<uint16_t, numSlots> slots{};
+};
+
+template<typename TValue, size_t N>
+consteval auto makeKeywordTable(std::pair<std::string_view, TValue> (&&entries)[N]) {
+	return KeywordTable<TValue, N>{std::to_array(std::move(entries))};
+}
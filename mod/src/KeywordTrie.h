@@ -0,0 +1,190 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Character trie over normalised keyword text.
+// Walking the trie through several adjacent tokens finds the longest keyword spanning them without
+// having to concatenate the tokens first. Insert everything, then compile() before matching.
+template<typename T>
+class KeywordTrie
+{
+public:
+	using NodeIndex = uint32_t;
+	static constexpr NodeIndex root = 0;
+	static constexpr NodeIndex npos = ~NodeIndex{0};
+	static constexpr size_t maxFuzzyLength = 63;
+
+	struct FuzzyMatch {
+		NodeIndex node = npos;
+		uint32_t distance = 0;
+		uint32_t length = 0;
+	};
+
+private:
+	struct Edge {
+		char c;
+		NodeIndex node;
+	};
+
+	struct Node {
+		uint32_t firstEdge = 0;
+		uint32_t numEdges = 0;
+		uint32_t value = npos;
+	};
+
+	std::vector<Node> nodes = {Node{}};
+	std::vector<Edge> edges;
+	std::vector<T> values;
+	std::vector<std::vector<Edge>> pendingEdges = {{}};
+
+public:
+	// Returns the value stored for the key, default constructing it on first insertion.
+	auto insert(std::string_view key) -> T& {
+		auto node = root;
+		for (auto c : key) {
+			auto& pending = this->pendingEdges[node];
+			auto it = std::find_if(pending.begin(), pending.end(), [c](const Edge& edge) { return edge.c == c; });
+			if (it != pending.end()) {
+				node = it->node;
+				continue;
+			}
+
+			auto next = static_cast<NodeIndex>(this->nodes.size());
+			pending.push_back({c, next});
+			this->nodes.emplace_back();
+			this->pendingEdges.emplace_back();
+			node = next;
+		}
+
+		auto& entry = this->nodes[node];
+		if (entry.value == npos) {
+			entry.value = static_cast<uint32_t>(this->values.size());
+			this->values.emplace_back();
+		}
+		return this->values[entry.value];
+	}
+
+	// Flattens the edges of every node into one sorted array.
+	auto compile() -> void {
+		this->edges.clear();
+		for (NodeIndex i = 0; i < this->nodes.size(); ++i) {
+			auto& pending = this->pendingEdges[i];
+			std::sort(pending.begin(), pending.end(), [](const Edge& a, const Edge& b) { return a.c < b.c; });
+			this->nodes[i].firstEdge = static_cast<uint32_t>(this->edges.size());
+			this->nodes[i].numEdges = static_cast<uint32_t>(pending.size());
+			this->edges.insert(this->edges.end(), pending.begin(), pending.end());
+		}
+		this->pendingEdges.clear();
+		this->pendingEdges.shrink_to_fit();
+	}
+
+	auto next(NodeIndex node, char c) const -> NodeIndex {
+		auto first = this->edges.begin() + this->nodes[node].firstEdge;
+		auto last = first + this->nodes[node].numEdges;
+		for (auto it = first; it != last && it->c <= c; ++it) {
+			if (it->c == c) return it->node;
+		}
+		return npos;
+	}
+
+	auto next(NodeIndex node, std::string_view text) const -> NodeIndex {
+		for (auto c : text) {
+			node = this->next(node, c);
+			if (node == npos) break;
+		}
+		return node;
+	}
+
+	auto get(NodeIndex node) const -> const T* {
+		if (node == npos) return nullptr;
+		auto value = this->nodes[node].value;
+		return value != npos ? &this->values[value] : nullptr;
+	}
+
+	auto find(std::string_view key) const -> const T* {
+		return this->get(this->next(root, key));
+	}
+
+	// Finds keywords within `maxDistance` edits of `key` (insertions, deletions, substitutions and adjacent
+	// transpositions), walking the trie with one row of the edit distance table per character so whole branches
+	// are pruned once every cell exceeds the bound. The first `exactPrefix` characters must match exactly, which
+	// keeps the search narrow. Fills `matches` with the closest, ranked by distance and then by how close the
+	// keyword's length is to the key's. Returns the number of matches written.
+	auto findFuzzy(std::string_view key, uint32_t maxDistance, std::span<FuzzyMatch> matches, size_t exactPrefix = 0) const -> size_t {
+		if (key.size() > maxFuzzyLength || exactPrefix > key.size() || matches.empty()) return 0;
+
+		auto node = this->next(root, key.substr(0, exactPrefix));
+		if (node == npos) return 0;
+
+		FuzzySearch search{key.substr(exactPrefix), static_cast<uint32_t>(exactPrefix), maxDistance, matches};
+		Row row{};
+		for (size_t i = 0; i <= search.key.size(); ++i)
+			row[i] = static_cast<uint8_t>(i);
+
+		if (search.key.size() <= maxDistance && this->nodes[node].value != npos)
+			search.add({node, static_cast<uint32_t>(search.key.size()), search.prefixLength});
+
+		for (auto& edge : this->edgesOf(node))
+			this->findFuzzy(search, edge, row, row, '\0', 1);
+		return search.numMatches;
+	}
+
+private:
+	using Row = std::array<uint8_t, maxFuzzyLength + 1>;
+
+	struct FuzzySearch {
+		std::string_view key;
+		uint32_t prefixLength;
+		uint32_t maxDistance;
+		std::span<FuzzyMatch> matches;
+		size_t numMatches = 0;
+
+		auto rank(const FuzzyMatch& match) const {
+			auto keyLength = this->prefixLength + this->key.size();
+			auto lengthDiff = match.length > keyLength ? match.length - keyLength : keyLength - match.length;
+			return std::pair{match.distance, lengthDiff};
+		}
+
+		auto add(FuzzyMatch match) -> void {
+			auto pos = this->numMatches;
+			while (pos > 0 && this->rank(match) < this->rank(this->matches[pos - 1])) --pos;
+			if (pos >= this->matches.size()) return;
+			if (this->numMatches < this->matches.size()) ++this->numMatches;
+			std::move_backward(this->matches.begin() + pos, this->matches.begin() + this->numMatches - 1, this->matches.begin() + this->numMatches);
+			this->matches[pos] = match;
+		}
+	};
+
+	auto edgesOf(NodeIndex node) const {
+		return std::span<const Edge>{this->edges.data() + this->nodes[node].firstEdge, this->nodes[node].numEdges};
+	}
+
+	auto findFuzzy(FuzzySearch& search, const Edge& edge, const Row& prev, const Row& prevPrev, char prevChar, uint32_t depth) const -> void {
+		auto& key = search.key;
+		Row row{};
+		row[0] = static_cast<uint8_t>(std::min<uint32_t>(depth, 0xFF));
+		auto best = row[0];
+
+		for (size_t i = 1; i <= key.size(); ++i) {
+			auto cost = key[i - 1] == edge.c ? 0 : 1;
+			auto value = std::min({prev[i] + 1, row[i - 1] + 1, prev[i - 1] + cost});
+			if (depth > 1 && i > 1 && key[i - 1] == prevChar && key[i - 2] == edge.c)
+				value = std::min(value, prevPrev[i - 2] + 1);
+			row[i] = static_cast<uint8_t>(std::min(value, 0xFF));
+			best = std::min(best, row[i]);
+		}
+
+		if (best > search.maxDistance) return;
+
+		auto distance = row[key.size()];
+		if (distance <= search.maxDistance && this->nodes[edge.node].value != npos)
+			search.add({edge.node, distance, search.prefixLength + depth});
+
+		for (auto& child : this->edgesOf(edge.node))
+			this->findFuzzy(search, child, row, prev, edge.c, depth + 1);
+	}
+};
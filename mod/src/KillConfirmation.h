@@ -1,9 +1,10 @@
 #pragma once
 #include "Target.h"
+#include <cstdint>
 #include <string>
 #include <string_view>
 
-enum class eKillValidationType
+enum class eKillValidationType : uint8_t
 {
 	Unknown = 0,
 	Invalid = 1,
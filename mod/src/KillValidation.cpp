@@ -0,0 +1,475 @@
+#include "KillValidation.h"
+#include "SharedRouletteSpin.h"
+#include <algorithm>
+#include <string>
+
+namespace {
+	constexpr auto Valid = eKillValidationType::Valid;
+	constexpr auto AnyStandard = KillRuleMethod::Kind::AnyStandard;
+	constexpr auto AnyMap = KillRuleMethod::Kind::AnyMap;
+
+	constexpr KillRule rules[] = {
+		// Standard methods
+
+		// If expecting injected poison, determine whether the proxy medic opportunity was used
+		{
+			.method = eKillMethod::InjectedPoison,
+			.target = eTargetID::SierraKnox,
+			.when = {
+				.killMethodStrict = killRuleMask(eKillMethodStrict::None),
+				.killClass = killRuleMask(eKillClass::Poison),
+				.killContext = killRuleMask(EDeathContext::eDC_ACCIDENT),
+			},
+			.result = Valid,
+		},
+		// Car kill: EKillType_ItemTakeOutFront, KillClass "unknown", eDC_HIDDEN, no KillMethodBroad or KillMethodStrict
+		{
+			.method = eKillMethod::Explosion,
+			.target = eTargetID::SierraKnox,
+			.when = {
+				.facts = KillFact::ContextKill,
+				.killClass = killRuleMask(eKillClass::Unknown),
+				.killContext = killRuleMask(EDeathContext::eDC_HIDDEN),
+			},
+			.result = Valid,
+		},
+		{.method = AnyStandard, .killTypes = killRuleMask(eKillType::Silenced), .when = {.notFacts = KillFact::WeaponSilenced}},
+		{.method = AnyStandard, .killTypes = killRuleMask(eKillType::Loud), .when = {.facts = KillFact::WeaponSilenced}},
+
+		{.method = eKillMethod::NeckSnap, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::Unarmed)}, .result = Valid},
+		{.method = eKillMethod::NeckSnap},
+
+		{
+			.method = eKillMethod::Pistol,
+			.when = {.killMethodBroad = killRuleMask(eKillMethodBroad::Pistol, eKillMethodBroad::CloseCombatPistolElimination)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::Pistol},
+
+		{.method = eKillMethod::PistolElimination, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::CloseCombatPistolElimination)}, .result = Valid},
+		{.method = eKillMethod::PistolElimination},
+
+		// SMG eliminations are reported as melee kills with an SMG
+		{
+			.method = eKillMethod::SMG,
+			.when = {.killMethodBroad = killRuleMask(eKillMethodBroad::MeleeLethal), .killItemCategory = killRuleMask(eKillItemCategory::SMG)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::SMG, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::SMG)}, .result = Valid},
+		{.method = eKillMethod::SMG},
+
+		{
+			.method = eKillMethod::SMGElimination,
+			.when = {.killMethodBroad = killRuleMask(eKillMethodBroad::MeleeLethal), .killItemCategory = killRuleMask(eKillItemCategory::SMG)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::SMGElimination},
+
+		{.method = eKillMethod::Shotgun, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::Shotgun)}, .result = Valid},
+		{.method = eKillMethod::Shotgun},
+
+		{.method = eKillMethod::AssaultRifle, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::AssaultRifle)}, .result = Valid},
+		{.method = eKillMethod::AssaultRifle},
+
+		{.method = eKillMethod::Sniper, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::SniperRifle)}, .result = Valid},
+		{.method = eKillMethod::Sniper},
+
+		// Molotov burn kills
+		{
+			.method = eKillMethod::Explosive,
+			.killTypes = killRuleMask(eKillType::Any, eKillType::Loud, eKillType::Impact),
+			.when = {.facts = KillFact::Burn, .notFacts = KillFact::HaveKillMethod | KillFact::Accident},
+			.result = Valid,
+		},
+		// Deadly lock-on throw kills
+		{
+			.method = eKillMethod::Explosive,
+			.killTypes = killRuleMask(eKillType::Any, eKillType::Loud, eKillType::Impact),
+			.when = {
+				.facts = KillFact::ExplosiveSuitsKillType,
+				.killMethodBroad = killRuleMask(eKillMethodBroad::Throw),
+				.killClass = killRuleMask(eKillClass::Melee),
+			},
+			.result = Valid,
+		},
+		{
+			.method = eKillMethod::Explosive,
+			.when = {.facts = KillFact::ExplosiveSuitsKillType, .killMethodBroad = killRuleMask(eKillMethodBroad::Explosive)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::Explosive},
+
+		{.method = eKillMethod::FiberWire, .when = {.killMethodBroad = killRuleMask(eKillMethodBroad::FiberWire)}, .result = Valid},
+		{.method = eKillMethod::FiberWire},
+
+		// Ambiguous poisons count as either kind
+		{
+			.method = eKillMethod::InjectedPoison,
+			.when = {.killMethodStrict = killRuleMask(eKillMethodStrict::None), .killClass = killRuleMask(eKillClass::Poison)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::InjectedPoison, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::InjectedPoison)}, .result = Valid},
+		{.method = eKillMethod::InjectedPoison},
+
+		{
+			.method = eKillMethod::ConsumedPoison,
+			.when = {.killMethodStrict = killRuleMask(eKillMethodStrict::None), .killClass = killRuleMask(eKillClass::Poison)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::ConsumedPoison, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::ConsumedPoison)}, .result = Valid},
+		{.method = eKillMethod::ConsumedPoison},
+
+		{.method = eKillMethod::Drowning, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentDrown)}, .result = Valid},
+		{.method = eKillMethod::Drowning},
+
+		{.method = eKillMethod::Explosion, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentExplosion)}, .result = Valid},
+		{.method = eKillMethod::Explosion},
+
+		// A mysterious cause of death with some OOB kill indicators is assumed to be a fall
+		{
+			.method = eKillMethod::Fall,
+			.when = {
+				.notFacts = KillFact::HaveKillMethod | KillFact::HaveDamageEvents | KillFact::HaveKillItem,
+				.killClass = killRuleMask(eKillClass::Unknown),
+				.killContext = killRuleMask(EDeathContext::eDC_MURDER),
+				.killType = killRuleMask(EKillType::EKillType_ItemTakeOutFront),
+			},
+			.result = Valid,
+		},
+		{.method = eKillMethod::Fall, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentPush)}, .result = Valid},
+		{.method = eKillMethod::Fall},
+
+		{
+			.method = eKillMethod::FallingObject,
+			.when = {.killMethodStrict = killRuleMask(eKillMethodStrict::None), .setpiece = killRuleMask(eKillSetpiece::MumbaiFallingSign)},
+			.result = Valid,
+		},
+		{.method = eKillMethod::FallingObject, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentSuspendedObject)}, .result = Valid},
+		{.method = eKillMethod::FallingObject},
+
+		// Incinerator fire kills (this may also pass for garden shredder kills)
+		{
+			.method = eKillMethod::Fire,
+			.when = {
+				.facts = KillFact::InCloset | KillFact::IncineratorFlush,
+				.notFacts = KillFact::HaveKillMethod | KillFact::HaveKillItem,
+				.killMethodStrict = killRuleMask(eKillMethodStrict::None),
+				.killClass = killRuleMask(eKillClass::Unknown),
+				.killType = killRuleMask(EKillType::EKillType_ItemTakeOutFront),
+			},
+			.result = Valid,
+		},
+		{.method = eKillMethod::Fire, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentBurn)}, .result = Valid},
+		{.method = eKillMethod::Fire},
+
+		{.method = eKillMethod::Electrocution, .when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentElectric)}, .result = Valid},
+		{.method = eKillMethod::Electrocution},
+
+		// Map methods
+
+		// Best we can really do is just check Silvio ever entered the plane and the kill was an accident
+		// (it is possible to kill him directly with explosive while he is in the plane).
+		{
+			.method = eMapKillMethod::Silvio_SeaPlane,
+			.target = eTargetID::SilvioCaruso,
+			.when = {.facts = KillFact::SilvioInPlane | KillFact::Accident},
+			.result = Valid,
+		},
+		{.method = eMapKillMethod::Silvio_SeaPlane, .target = eTargetID::SilvioCaruso},
+		{
+			.method = eMapKillMethod::Silvio_ShootThroughTelescope,
+			.target = eTargetID::SilvioCaruso,
+			.when = {.setpiece = killRuleMask(eKillSetpiece::SilvioTelescope)},
+			.result = Valid,
+		},
+		{.method = eMapKillMethod::Silvio_ShootThroughTelescope, .target = eTargetID::SilvioCaruso},
+
+		{.method = eMapKillMethod::Jordan_CakeSmother, .target = eTargetID::JordanCross, .when = {.setpiece = killRuleMask(eKillSetpiece::JordanCake)}, .result = Valid},
+		{.method = eMapKillMethod::Jordan_CakeSmother, .target = eTargetID::JordanCross},
+
+		{
+			.method = eMapKillMethod::Sean_ExplosiveWatchBattery,
+			.target = eTargetID::SeanRose,
+			.when = {.setpiece = killRuleMask(eKillSetpiece::SeanWatchBattery)},
+			.result = Valid,
+		},
+		{.method = eMapKillMethod::Sean_ExplosiveWatchBattery, .target = eTargetID::SeanRose},
+
+		{.method = eMapKillMethod::Yuki_Sauna, .target = eTargetID::YukiYamazaki, .when = {.setpiece = killRuleMask(eKillSetpiece::YukiSauna)}, .result = Valid},
+		{.method = eMapKillMethod::Yuki_Sauna, .target = eTargetID::YukiYamazaki},
+		{.method = eMapKillMethod::Yuki_SabotageCableCar, .target = eTargetID::YukiYamazaki, .when = {.facts = KillFact::CablecarDown}, .result = Valid},
+		{.method = eMapKillMethod::Yuki_SabotageCableCar, .target = eTargetID::YukiYamazaki},
+
+		// Proxy medic opportunity
+		{
+			.method = eMapKillMethod::Sierra_PoisonIVDrip,
+			.target = eTargetID::SierraKnox,
+			.when = {
+				.killMethodStrict = killRuleMask(eKillMethodStrict::None),
+				.killClass = killRuleMask(eKillClass::Poison),
+				.killContext = killRuleMask(EDeathContext::eDC_ACCIDENT),
+			},
+			.result = Valid,
+		},
+		{.method = eMapKillMethod::Sierra_PoisonIVDrip, .target = eTargetID::SierraKnox},
+		{
+			.method = eMapKillMethod::Sierra_BombCar,
+			.target = eTargetID::SierraKnox,
+			.when = {
+				.facts = KillFact::ContextKill,
+				.killClass = killRuleMask(eKillClass::Unknown),
+				.killContext = killRuleMask(EDeathContext::eDC_HIDDEN),
+			},
+			.result = Valid,
+		},
+		{
+			.method = eMapKillMethod::Sierra_ShootCar,
+			.target = eTargetID::SierraKnox,
+			.when = {
+				.facts = KillFact::ContextKill,
+				.killClass = killRuleMask(eKillClass::Unknown),
+				.killContext = killRuleMask(EDeathContext::eDC_HIDDEN),
+			},
+			.result = Valid,
+		},
+
+		// Dumping into the enclosure is validated by its own event, this is the context kill push with cutscene.
+		{.method = eMapKillMethod::Rico_FeedToHippo, .target = eTargetID::RicoDelgado, .when = {.setpiece = killRuleMask(eKillSetpiece::RicoHippo)}, .result = Valid},
+		{.method = eMapKillMethod::Rico_FeedToHippo, .target = eTargetID::RicoDelgado},
+
+		{
+			.method = eMapKillMethod::Jorge_CocaineMachine,
+			.target = eTargetID::JorgeFranco,
+			.when = {.setpiece = killRuleMask(eKillSetpiece::JorgeCocaineMachine)},
+			.result = Valid,
+		},
+		// For KO and dump, it should be sufficient to check the kill happened inside a container.
+		{.method = eMapKillMethod::Jorge_CocaineMachine, .target = eTargetID::JorgeFranco, .when = {.facts = KillFact::InCloset}, .result = Valid},
+		{.method = eMapKillMethod::Jorge_CocaineMachine, .target = eTargetID::JorgeFranco},
+
+		{.method = eMapKillMethod::Vanya_SteamPool, .target = eTargetID::VanyaShah, .when = {.setpiece = killRuleMask(eKillSetpiece::VanyaSteamPool)}, .result = Valid},
+		{.method = eMapKillMethod::Vanya_SteamPool, .target = eTargetID::VanyaShah},
+
+		{.method = eMapKillMethod::Janus_Sculpture, .target = eTargetID::Janus, .when = {.setpiece = killRuleMask(eKillSetpiece::JanusSculpture)}, .result = Valid},
+		{.method = eMapKillMethod::Janus_Sculpture, .target = eTargetID::Janus},
+
+		{.method = eMapKillMethod::Athena_Award, .target = eTargetID::AthenaSavalas, .when = {.setpiece = killRuleMask(eKillSetpiece::AthenaAward)}, .result = Valid},
+		{.method = eMapKillMethod::Athena_Award, .target = eTargetID::AthenaSavalas},
+
+		// 'Legit' water scooter kill
+		{
+			.method = eMapKillMethod::Steven_BombWaterScooter,
+			.target = eTargetID::StevenBradley,
+			.when = {.setpiece = killRuleMask(eKillSetpiece::StevenWaterScooterRide)},
+			.result = Valid,
+		},
+		// Otherwise an accident explosion, as validated for the standard method, with the water scooter blowing up
+		// around the same time. Technically this can validate even if Steven is killed in an unrelated accident
+		// explosion and the scooter also gets blown up around the same time, but fuck it
+		{.method = eMapKillMethod::Steven_BombWaterScooter, .target = eTargetID::StevenBradley, .when = {.notFacts = KillFact::WaterScooterSetpiece}},
+		{
+			.method = eMapKillMethod::Steven_BombWaterScooter,
+			.target = eTargetID::StevenBradley,
+			.killTypes = killRuleMask(eKillType::Silenced),
+			.when = {.notFacts = KillFact::WeaponSilenced},
+		},
+		{
+			.method = eMapKillMethod::Steven_BombWaterScooter,
+			.target = eTargetID::StevenBradley,
+			.killTypes = killRuleMask(eKillType::Loud),
+			.when = {.facts = KillFact::WeaponSilenced},
+		},
+		{
+			.method = eMapKillMethod::Steven_BombWaterScooter,
+			.target = eTargetID::StevenBradley,
+			.when = {.killMethodStrict = killRuleMask(eKillMethodStrict::AccidentExplosion)},
+			.result = Valid,
+		},
+		{.method = eMapKillMethod::Steven_BombWaterScooter, .target = eTargetID::StevenBradley},
+
+		// Anything else is validated by the kill item's repository ID.
+		{
+			.method = AnyMap,
+			.killTypes = killRuleMask(eKillType::Thrown),
+			.when = {.facts = KillFact::HaveKillItem, .killMethodBroad = killRuleMaskExcept(eKillMethodBroad::Throw)},
+			.reason = "expected 'throw'",
+		},
+		{
+			.method = AnyMap,
+			.killTypes = killRuleMask(eKillType::Melee),
+			.when = {.facts = KillFact::HaveKillItem, .killMethodBroad = killRuleMaskExcept(eKillMethodBroad::MeleeLethal)},
+			.reason = "expected 'melee_lethal'",
+		},
+		{.method = AnyMap, .when = {.facts = KillFact::ItemIsExpectedMethod}, .result = Valid},
+		{.method = AnyMap, .when = {.facts = KillFact::HaveKillItem, .notFacts = KillFact::ItemMethodKnown}, .reason = "repo ID unknown"},
+		{.method = AnyMap, .when = {.facts = KillFact::HaveKillItem}, .reason = "repo ID kill method mismatch"},
+		{.method = AnyMap},
+	};
+
+	// Whether the kill item suits the expected kill type of an explosive kill, as checkExplosiveKillType.
+	auto explosiveSuitsKillType(uint32_t facts, eKillType type) -> bool {
+		switch (type) {
+		case eKillType::Any:
+			return true;
+		case eKillType::Loud:
+			return !(facts & KillFact::ItemNonLoudExplosive);
+		case eKillType::Remote:
+			return !(facts & KillFact::ItemImpactExplosive);
+		case eKillType::Impact:
+			return !(facts & KillFact::HaveKillItem) || (facts & KillFact::ItemImpactExplosive);
+		case eKillType::LoudRemote:
+			return !(facts & (KillFact::ItemNonLoudExplosive | KillFact::ItemImpactExplosive));
+		}
+		return false;
+	}
+
+	auto getSessionFacts(const SharedRouletteSpin& spin, const KillEventFacts& kill, uint32_t wanted) -> uint32_t {
+		uint32_t facts = 0;
+		if (wanted & KillFact::IncineratorFlush) {
+			auto setpiece = spin.getSetpieceEventAtTimestamp(kill.timestamp);
+			if (setpiece && isIncineratorSetpiece(setpiece->id) && setpiece->name == "BodyFlushed")
+				facts |= KillFact::IncineratorFlush;
+		}
+		if (wanted & KillFact::WaterScooterSetpiece) {
+			auto setpiece = spin.getSetpieceEventAtTimestamp(kill.timestamp, 0.3);
+			if (setpiece && setpiece->id == "2f4a7b8f-a5f1-4c59-8a0e-678b3c2ee32f")
+				facts |= KillFact::WaterScooterSetpiece;
+		}
+		if ((wanted & KillFact::SilvioInPlane) && spin.getLevelSetupEventByEvent("Silvio_InPlane"))
+			facts |= KillFact::SilvioInPlane;
+		if ((wanted & KillFact::CablecarDown) && spin.getLevelSetupEventByEvent("Cablecar_Down"))
+			facts |= KillFact::CablecarDown;
+		return facts;
+	}
+}
+
+constinit const std::span<const KillRule> killValidationRules = rules;
+
+KillEventFacts::KillEventFacts(const KillEventValue& kill, double timestamp) :
+	killMethodBroad(kill.KillMethodBroad),
+	killMethodStrict(kill.KillMethodStrict),
+	killClass(kill.KillClass),
+	killItemCategory(kill.KillItemCategory),
+	killContext(kill.KillContext),
+	killType(kill.KillType),
+	timestamp(timestamp)
+{
+	if (kill.Accident) this->facts |= KillFact::Accident;
+	if (kill.WeaponSilenced) this->facts |= KillFact::WeaponSilenced;
+	if (this->killMethodBroad != eKillMethodBroad::None || this->killMethodStrict != eKillMethodStrict::None)
+		this->facts |= KillFact::HaveKillMethod;
+
+	if (!kill.DamageEvents.empty()) {
+		this->facts |= KillFact::HaveDamageEvents;
+		if (kill.DamageEvents[0] == eDamageEvent::ContextKill) this->facts |= KillFact::ContextKill;
+		if (kill.DamageEvents[0] == eDamageEvent::Burn) this->facts |= KillFact::Burn;
+		if (std::find(kill.DamageEvents.cbegin(), kill.DamageEvents.cend(), eDamageEvent::InCloset) != kill.DamageEvents.cend())
+			this->facts |= KillFact::InCloset;
+	}
+
+	if (!kill.SetPieceId.empty()) {
+		auto setpiece = killSetpieceTable.findExact(kill.SetPieceId);
+		this->setpiece = setpiece ? *setpiece : eKillSetpiece::Other;
+	}
+
+	if (!kill.KillItemRepositoryId.empty()) {
+		this->facts |= KillFact::HaveKillItem;
+		auto repoId = std::string(kill.KillItemRepositoryId);
+		if (nonLoudExplosives.contains(repoId)) this->facts |= KillFact::ItemNonLoudExplosive;
+		if (impactExplosives.contains(repoId)) this->facts |= KillFact::ItemImpactExplosive;
+		if (auto it = specificKillMethodsByRepoId.find(repoId); it != specificKillMethodsByRepoId.end()) {
+			this->facts |= KillFact::ItemMethodKnown;
+			this->itemMethod = it->second;
+		}
+	}
+}
+
+auto KillPredicate::matches(const KillEventFacts& kill, uint32_t facts) const -> bool {
+	auto accepts = [](uint32_t mask, auto value) {
+		return !mask || (mask & killRuleBit(value));
+	};
+	return (facts & this->facts) == this->facts
+		&& !(facts & this->notFacts)
+		&& accepts(this->killMethodBroad, kill.killMethodBroad)
+		&& accepts(this->killMethodStrict, kill.killMethodStrict)
+		&& accepts(this->killClass, kill.killClass)
+		&& accepts(this->killItemCategory, kill.killItemCategory)
+		&& accepts(this->killContext, kill.killContext)
+		&& accepts(this->killType, kill.killType)
+		&& accepts(this->setpiece, kill.setpiece);
+}
+
+KillValidator::KillValidator(std::span<const KillRule> rules) {
+	using Kind = KillRuleMethod::Kind;
+
+	// Methods with rules of their own get the rules for any method of their kind too, in the order they're declared.
+	std::vector<bool> standardHasRules;
+	std::vector<bool> mapHasRules;
+	for (auto& rule : rules) {
+		if (rule.method.kind != Kind::Standard && rule.method.kind != Kind::Map) continue;
+		auto& hasRules = rule.method.kind == Kind::Standard ? standardHasRules : mapHasRules;
+		if (hasRules.size() <= rule.method.method) hasRules.resize(rule.method.method + 1);
+		hasRules[rule.method.method] = true;
+	}
+	this->standardRules.resize(standardHasRules.size());
+	this->mapRules.resize(mapHasRules.size());
+
+	auto add = [](MethodRules& method, const KillRule& rule) {
+		method.rules.push_back(&rule);
+		method.sessionFacts |= (rule.when.facts | rule.when.notFacts) & KillFact::SessionFacts;
+	};
+
+	for (auto& rule : rules) {
+		switch (rule.method.kind) {
+		case Kind::Standard:
+			add(this->standardRules[rule.method.method], rule);
+			break;
+		case Kind::Map:
+			add(this->mapRules[rule.method.method], rule);
+			break;
+		case Kind::AnyStandard:
+			add(this->anyStandardRules, rule);
+			for (size_t i = 0; i < this->standardRules.size(); ++i) {
+				if (standardHasRules[i]) add(this->standardRules[i], rule);
+			}
+			break;
+		case Kind::AnyMap:
+			add(this->anyMapRules, rule);
+			for (size_t i = 0; i < this->mapRules.size(); ++i) {
+				if (mapHasRules[i]) add(this->mapRules[i], rule);
+			}
+			break;
+		}
+	}
+}
+
+auto KillValidator::validate(eTargetID target, const KillEventFacts& kill, eKillMethod method, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation {
+	auto index = static_cast<size_t>(method);
+	auto& rules = index < this->standardRules.size() && !this->standardRules[index].rules.empty()
+		? this->standardRules[index]
+		: this->anyStandardRules;
+	return this->validate(rules, target, kill, eMapKillMethod::NONE, type, spin);
+}
+
+auto KillValidator::validate(eTargetID target, const KillEventFacts& kill, eMapKillMethod method, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation {
+	auto index = static_cast<size_t>(method);
+	auto& rules = index < this->mapRules.size() && !this->mapRules[index].rules.empty()
+		? this->mapRules[index]
+		: this->anyMapRules;
+	return this->validate(rules, target, kill, method, type, spin);
+}
+
+auto KillValidator::validate(const MethodRules& rules, eTargetID target, const KillEventFacts& kill, eMapKillMethod itemMethod, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation {
+	auto facts = kill.facts;
+	if (explosiveSuitsKillType(facts, type)) facts |= KillFact::ExplosiveSuitsKillType;
+	if ((facts & KillFact::ItemMethodKnown) && kill.itemMethod == itemMethod) facts |= KillFact::ItemIsExpectedMethod;
+	if (rules.sessionFacts) facts |= getSessionFacts(spin, kill, rules.sessionFacts);
+
+	auto typeBit = killRuleBit(type);
+	for (auto rule : rules.rules) {
+		if (rule->target != eTargetID::Unknown && rule->target != target) continue;
+		if (rule->killTypes && !(rule->killTypes & typeBit)) continue;
+		if (rule->when.matches(kill, facts)) return {rule->result, rule};
+	}
+	return {};
+}
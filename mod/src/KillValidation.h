@@ -0,0 +1,217 @@
+#pragma once
+#include "Enums.h"
+#include "Events.h"
+#include "KeywordTable.h"
+#include "KillConfirmation.h"
+#include "KillMethod.h"
+#include "Target.h"
+#include <Glacier/Enums.h>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+struct SharedRouletteSpin;
+
+// Kill validation as a table of rules, each mapping an expected method, kill type and target to a predicate over the
+// kill. KillValidator compiles the table into per-method rule lists once, and a kill is reduced to KillEventFacts once,
+// so validating it against a condition is a walk over a few integer masks with no string compares.
+
+// Setpieces the rules ask about, interned from a kill's SetPieceId.
+enum class eKillSetpiece : uint8_t {
+	None,
+	Other,
+	MumbaiFallingSign,
+	SilvioTelescope,
+	JordanCake,
+	SeanWatchBattery,
+	YukiSauna,
+	RicoHippo,
+	JorgeCocaineMachine,
+	VanyaSteamPool,
+	JanusSculpture,
+	AthenaAward,
+	StevenWaterScooterRide,
+};
+
+inline constexpr auto killSetpieceTable = makeKeywordTable<eKillSetpiece>({
+	// The game sometimes reports no kill method for a falling sign, only the setpiece, so all of these count.
+	{"701a4dfc-fb62-4702-ac1d-a07188851642", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
+	{"52837b63-b731-45e5-b220-d6680ac5eb16", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_02
+	{"d785c660-6b7a-4804-979b-34921b75c138", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
+	{"4b19effc-09ae-476c-9124-c811a0f82d51", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_08
+	{"9c94f9ed-6083-4c4e-94a3-067dce5db327", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_03
+	{"3d937afc-e4c2-432f-b852-0daf0f73c855", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D
+	{"8e474ae0-699f-44b5-8343-d09eadc9a8af", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_01
+	{"f97e7a1d-f188-4bb5-a46d-bc97505c667f", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
+	{"82864825-624e-40a4-9b17-0d51a7aa663d", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
+	{"205dfccf-c187-4867-890e-0a3f3856ed09", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_05
+	{"ed5d28f9-70b7-4460-b0db-8d1e0f3970e4", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_06
+	{"46d62cd5-6b7a-4ef1-b284-2e06391197d3", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_04
+	{"379402c3-0f48-440a-bb0c-e6d70ae16e77", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_06
+	{"1d5c45af-ef8a-45f2-aab2-262e337f2584", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
+	{"27ad6d30-1587-4411-8507-17c19b311c9e", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
+	{"3bf4a4c5-be0a-423a-b34b-fe29602ac499", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_04
+	{"e237df91-9ea7-4c96-b711-d29d11b70a73", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_B_05
+	{"d0eb2ff6-d95a-48b5-816c-394cadc7e3e5", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_03
+	{"6ea6dc37-beb1-465c-aa67-706be152b137", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
+	{"98be2403-5d97-4eea-840f-876adaa098c4", eKillSetpiece::MumbaiFallingSign}, // SetPiece_Mumbai_Falling_Sign_Shop_Electric_D_04
+	{"a84ba351-285a-4f07-8758-2d7640401aad", eKillSetpiece::SilvioTelescope},
+	{"be8452d0-3ce9-4f41-b1c2-a381d7e95e15", eKillSetpiece::JordanCake},
+	{"66d7a0d3-7ee8-4065-9475-8765fca06faa", eKillSetpiece::SeanWatchBattery},
+	{"9477e941-880c-4b05-932f-d431eaeb634e", eKillSetpiece::YukiSauna},
+	{"41f35d49-c74a-4de2-8119-d11cfef0b408", eKillSetpiece::RicoHippo}, // context kill push with cutscene
+	{"803b6461-0c4c-4f3d-9d6a-d9219a9d3136", eKillSetpiece::JorgeCocaineMachine}, // context kill with cutscene
+	{"36744d6c-77e9-429a-98d6-8cfc1b93454f", eKillSetpiece::VanyaSteamPool},
+	{"2258f06a-76d0-49a1-ba01-b34d894760bf", eKillSetpiece::JanusSculpture},
+	{"1a29d28c-be03-4149-b49c-b0c38d060772", eKillSetpiece::AthenaAward}, // setpiece_raccoon_unique.template -> SetpieceHelpers_ContextKill_CustomSequence2
+	{"0bd4c163-9674-403a-aa3d-a714be3d7a09", eKillSetpiece::StevenWaterScooterRide}, // setpiece_stingray_unique.template -> Setpiece_Trap_WaterScooterRide
+});
+
+// Yes/no facts about a kill, one bit each.
+struct KillFact {
+	enum : uint32_t {
+		Accident = 1 << 0,
+		WeaponSilenced = 1 << 1,
+		HaveKillItem = 1 << 2,
+		// KillMethodBroad or KillMethodStrict is set.
+		HaveKillMethod = 1 << 3,
+		HaveDamageEvents = 1 << 4,
+		// The first damage event.
+		ContextKill = 1 << 5,
+		Burn = 1 << 6,
+		// Any damage event.
+		InCloset = 1 << 7,
+		ItemNonLoudExplosive = 1 << 8,
+		ItemImpactExplosive = 1 << 9,
+		// The kill item is in specificKillMethodsByRepoId.
+		ItemMethodKnown = 1 << 10,
+
+		// Depend on the condition being validated.
+		ExplosiveSuitsKillType = 1 << 16,
+		ItemIsExpectedMethod = 1 << 17,
+
+		// Depend on the session, so they're only looked up for methods with rules that test them.
+		// An incinerator setpiece flushed a body at the time of the kill.
+		IncineratorFlush = 1 << 24,
+		// The water scooter setpiece went off at the time of the kill.
+		WaterScooterSetpiece = 1 << 25,
+		SilvioInPlane = 1 << 26,
+		CablecarDown = 1 << 27,
+
+		ConditionFacts = ExplosiveSuitsKillType | ItemIsExpectedMethod,
+		SessionFacts = IncineratorFlush | WaterScooterSetpiece | SilvioInPlane | CablecarDown,
+	};
+};
+
+// What the rules know about a kill, derived from the event once and then tested against any number of conditions.
+struct KillEventFacts {
+	uint32_t facts = 0;
+	eKillMethodBroad killMethodBroad = eKillMethodBroad::None;
+	eKillMethodStrict killMethodStrict = eKillMethodStrict::None;
+	eKillClass killClass = eKillClass::None;
+	eKillItemCategory killItemCategory = eKillItemCategory::None;
+	EDeathContext killContext = {};
+	EKillType killType = {};
+	eKillSetpiece setpiece = eKillSetpiece::None;
+	eMapKillMethod itemMethod = eMapKillMethod::NONE;
+	double timestamp = 0;
+
+	KillEventFacts() = default;
+	KillEventFacts(const KillEventValue& kill, double timestamp);
+};
+
+// Bit for each of a set of enum values, for the masks below.
+template<typename TEnum>
+constexpr auto killRuleBit(TEnum value) -> uint32_t {
+	auto n = static_cast<uint32_t>(value);
+	return n < 32 ? 1u << n : 0;
+}
+
+template<typename TEnum, typename... TEnums>
+constexpr auto killRuleMask(TEnum value, TEnums... values) -> uint32_t {
+	return (killRuleBit(value) | ... | killRuleBit(values));
+}
+
+template<typename TEnum, typename... TEnums>
+constexpr auto killRuleMaskExcept(TEnum value, TEnums... values) -> uint32_t {
+	return ~killRuleMask(value, values...);
+}
+
+// What a kill has to be for a rule to apply, all of it. Masks hold a bit per accepted value and 0 accepts any.
+struct KillPredicate {
+	uint32_t facts = 0;
+	uint32_t notFacts = 0;
+	uint32_t killMethodBroad = 0;
+	uint32_t killMethodStrict = 0;
+	uint32_t killClass = 0;
+	uint32_t killItemCategory = 0;
+	uint32_t killContext = 0;
+	uint32_t killType = 0;
+	uint32_t setpiece = 0;
+
+	auto matches(const KillEventFacts& kill, uint32_t facts) const -> bool;
+};
+
+// The expected methods a rule is for: one standard or map method, or all of either.
+struct KillRuleMethod {
+	enum class Kind : uint8_t {
+		Standard,
+		Map,
+		AnyStandard,
+		AnyMap,
+	};
+
+	Kind kind;
+	uint8_t method = 0;
+
+	constexpr KillRuleMethod(eKillMethod method) : kind(Kind::Standard), method(static_cast<uint8_t>(method)) { }
+	constexpr KillRuleMethod(eMapKillMethod method) : kind(Kind::Map), method(static_cast<uint8_t>(method)) { }
+	constexpr KillRuleMethod(Kind kind) : kind(kind) { }
+};
+
+struct KillRule {
+	KillRuleMethod method;
+	// Unknown for any target.
+	eTargetID target = eTargetID::Unknown;
+	// Bit per expected eKillType, 0 for any.
+	uint32_t killTypes = 0;
+	KillPredicate when;
+	eKillValidationType result = eKillValidationType::Invalid;
+	// Logged when this rule fails a kill.
+	std::string_view reason = "";
+};
+
+struct KillValidation {
+	eKillValidationType result = eKillValidationType::Unknown;
+	// The rule that decided, null if none applied.
+	const KillRule* rule = nullptr;
+};
+
+// The rules of each expected method in the order they're tried; the first that matches decides.
+extern const std::span<const KillRule> killValidationRules;
+
+class KillValidator {
+public:
+	KillValidator(std::span<const KillRule> rules = killValidationRules);
+
+	auto validate(eTargetID target, const KillEventFacts& kill, eKillMethod method, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation;
+	auto validate(eTargetID target, const KillEventFacts& kill, eMapKillMethod method, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation;
+
+private:
+	struct MethodRules {
+		std::vector<const KillRule*> rules;
+		// Session facts tested by any of the rules.
+		uint32_t sessionFacts = 0;
+	};
+
+	auto validate(const MethodRules& rules, eTargetID target, const KillEventFacts& kill, eMapKillMethod itemMethod, eKillType type, const SharedRouletteSpin& spin) const -> KillValidation;
+
+	// Indexed by method. Methods without rules of their own use the rules for any method of their kind.
+	std::vector<MethodRules> standardRules;
+	std::vector<MethodRules> mapRules;
+	MethodRules anyStandardRules;
+	MethodRules anyMapRules;
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include "KillConfirmation.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Events that move a condition's kill validation from one state to the next.
+enum class eKillValidationEvent : uint8_t {
+	// The target was KO'd.
+	Pacified,
+	// The KO'd target came round.
+	CameRound,
+	// The target's kill was validated.
+	Killed,
+	// The mission was exited, so validations still incomplete can't be completed.
+	Completed,
+};
+
+// Each condition's kill validation, only changed by typed transitions. Every transition is O(1) and is journaled with the
+// timestamp of the event that drove it, so the state at an earlier time can be restored when a save is loaded. A target
+// coming round has no event, so it's journaled at the time on the game's event clock that its actor was seen up.
+class KillValidationState
+{
+public:
+	struct Transition {
+		double timestamp;
+		uint8_t condition;
+		eKillValidationEvent event;
+		KillConfirmation after;
+	};
+
+	auto reset(size_t numConditions) -> void {
+		this->validations.assign(numConditions, KillConfirmation{});
+		this->journal.clear();
+	}
+
+	auto pacify(size_t condition, eTargetID target, double timestamp) -> void {
+		auto kc = this->validations[condition];
+		kc.target = target;
+		kc.isPacified = true;
+		this->transition(condition, eKillValidationEvent::Pacified, kc, timestamp);
+	}
+
+	auto cameRound(size_t condition, double timestamp) -> void {
+		auto kc = this->validations[condition];
+		if (!kc.isPacified) return;
+		kc.isPacified = false;
+		this->transition(condition, eKillValidationEvent::CameRound, kc, timestamp);
+	}
+
+	auto kill(size_t condition, const KillConfirmation& result, double timestamp) -> void {
+		this->transition(condition, eKillValidationEvent::Killed, result, timestamp);
+	}
+
+	auto complete(double timestamp) -> void {
+		for (size_t i = 0; i < this->validations.size(); ++i) {
+			if (this->validations[i].correctMethod != eKillValidationType::Incomplete) continue;
+			auto kc = this->validations[i];
+			kc.correctMethod = eKillValidationType::Invalid;
+			this->transition(i, eKillValidationEvent::Completed, kc, timestamp);
+		}
+	}
+
+	// Restores the state as it was at the timestamp, forgetting the transitions after it.
+	auto restoreAt(double timestamp) -> void {
+		// The journal is in timestamp order, as restoring truncates it before anything later is added.
+		auto it = std::upper_bound(this->journal.begin(), this->journal.end(), timestamp, [](double timestamp, const Transition& t) {
+			return timestamp < t.timestamp;
+		});
+		this->journal.erase(it, this->journal.end());
+
+		this->validations.assign(this->validations.size(), KillConfirmation{});
+		for (auto const& transition : this->journal)
+			this->validations[transition.condition] = transition.after;
+	}
+
+	auto operator[](size_t condition) const -> const KillConfirmation& { return this->validations[condition]; }
+	auto begin() const { return this->validations.begin(); }
+	auto end() const { return this->validations.end(); }
+	auto size() const -> size_t { return this->validations.size(); }
+
+private:
+	auto transition(size_t condition, eKillValidationEvent event, const KillConfirmation& after, double timestamp) -> void {
+		this->validations[condition] = after;
+		// Events can arrive slightly out of order, keep the journal sorted for restoreAt.
+		if (!this->journal.empty()) timestamp = std::max(timestamp, this->journal.back().timestamp);
+		this->journal.push_back({timestamp, static_cast<uint8_t>(condition), event, after});
+	}
+
+	std::vector<KillConfirmation> validations;
+	std::vector<Transition> journal;
+};
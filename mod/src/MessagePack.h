@@ -0,0 +1,267 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include "json.hpp"
+
+// Appends the values it's given as MessagePack, for encoding a dynamic object with visitDynamicObject without a DOM.
+// Objects and arrays always get 32-bit headers with their size filled in when they end, as the sizes aren't known up
+// front for values that come through sax_parse. Writes nothing to the heap once `out` has the capacity it needs.
+class MessagePackWriter
+{
+public:
+	explicit MessagePackWriter(std::vector<uint8_t>& out) : out(out) { }
+
+	auto null() -> bool {
+		if (!this->element()) return false;
+		this->out.push_back(0xC0);
+		return true;
+	}
+
+	auto boolean(bool b) -> bool {
+		if (!this->element()) return false;
+		this->out.push_back(b ? 0xC3 : 0xC2);
+		return true;
+	}
+
+	auto number_integer(int64_t n) -> bool {
+		if (n >= 0) return this->number_unsigned(static_cast<uint64_t>(n));
+		if (!this->element()) return false;
+		if (n >= -32) this->out.push_back(static_cast<uint8_t>(n));
+		else if (n >= INT8_MIN) this->appendHeader(0xD0, static_cast<uint8_t>(n));
+		else if (n >= INT16_MIN) this->appendHeader(0xD1, static_cast<uint16_t>(n));
+		else if (n >= INT32_MIN) this->appendHeader(0xD2, static_cast<uint32_t>(n));
+		else this->appendHeader(0xD3, static_cast<uint64_t>(n));
+		return true;
+	}
+
+	auto number_unsigned(uint64_t n) -> bool {
+		if (!this->element()) return false;
+		if (n < 0x80) this->out.push_back(static_cast<uint8_t>(n));
+		else if (n <= UINT8_MAX) this->appendHeader(0xCC, static_cast<uint8_t>(n));
+		else if (n <= UINT16_MAX) this->appendHeader(0xCD, static_cast<uint16_t>(n));
+		else if (n <= UINT32_MAX) this->appendHeader(0xCE, static_cast<uint32_t>(n));
+		else this->appendHeader(0xCF, n);
+		return true;
+	}
+
+	auto number_float(double n, const std::string&) -> bool {
+		if (!this->element()) return false;
+		this->appendHeader(0xCB, std::bit_cast<uint64_t>(n));
+		return true;
+	}
+
+	auto string(const std::string& str) -> bool {
+		if (!this->element()) return false;
+		this->appendString(str);
+		return true;
+	}
+
+	auto binary(nlohmann::json::binary_t&) -> bool {
+		return false;
+	}
+
+	auto key(const std::string& str) -> bool {
+		if (!this->depth) return false;
+		++this->frames[this->depth - 1].size;
+		this->appendString(str);
+		return true;
+	}
+
+	auto start_object(size_t) -> bool { return this->open(0xDF, true); }
+	auto start_array(size_t) -> bool { return this->open(0xDD, false); }
+	auto end_object() -> bool { return this->close(); }
+	auto end_array() -> bool { return this->close(); }
+
+	auto parse_error(size_t, const std::string&, const nlohmann::detail::exception&) -> bool {
+		return false;
+	}
+
+private:
+	struct Frame {
+		size_t offset = 0;
+		uint32_t size = 0;
+		bool isObject = false;
+	};
+
+	// Deeper than any event, anything this deep is refused rather than written.
+	static constexpr size_t maxDepth = 32;
+
+	// Counts a value towards the array it's in. Values in objects are counted by their keys.
+	auto element() -> bool {
+		if (!this->depth) return !std::exchange(this->done, true);
+		auto& frame = this->frames[this->depth - 1];
+		if (!frame.isObject) ++frame.size;
+		return true;
+	}
+
+	auto open(uint8_t marker, bool isObject) -> bool {
+		if (!this->element() || this->depth == maxDepth) return false;
+		this->frames[this->depth++] = {this->out.size(), 0, isObject};
+		this->appendHeader(marker, uint32_t{0});
+		return true;
+	}
+
+	auto close() -> bool {
+		if (!this->depth) return false;
+		auto const& frame = this->frames[--this->depth];
+		for (size_t i = 0; i < sizeof(uint32_t); ++i)
+			this->out[frame.offset + 1 + i] = static_cast<uint8_t>(frame.size >> ((sizeof(uint32_t) - 1 - i) * 8));
+		return true;
+	}
+
+	auto appendString(const std::string& str) -> void {
+		auto const size = str.size();
+		if (size < 32) this->out.push_back(static_cast<uint8_t>(0xA0 | size));
+		else if (size <= UINT8_MAX) this->appendHeader(0xD9, static_cast<uint8_t>(size));
+		else if (size <= UINT16_MAX) this->appendHeader(0xDA, static_cast<uint16_t>(size));
+		else this->appendHeader(0xDB, static_cast<uint32_t>(size));
+		this->out.insert(this->out.end(), str.begin(), str.end());
+	}
+
+	// MessagePack is big endian.
+	template<typename T>
+	auto appendHeader(uint8_t marker, T value) -> void {
+		this->out.push_back(marker);
+		for (size_t i = sizeof(T); i-- > 0;)
+			this->out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8)));
+	}
+
+	std::vector<uint8_t>& out;
+	std::array<Frame, maxDepth> frames{};
+	size_t depth = 0;
+	// Set once a value at the top level is started, a second one would make the payload unreadable.
+	bool done = false;
+};
+
+namespace MessagePackDetail {
+	// Strings are handed to visitors in a buffer kept per thread, so reading doesn't allocate for them once it's grown to
+	// fit. Visitors are done with each one before the read moves on.
+	inline auto scratch() -> std::string& {
+		thread_local std::string scratch;
+		return scratch;
+	}
+
+	template<typename TVisitor>
+	class Reader
+	{
+	public:
+		Reader(std::span<const uint8_t> data, TVisitor& visitor) : data(data), visitor(visitor) { }
+
+		auto value(size_t depth) -> bool {
+			if (this->pos == this->data.size() || depth == maxDepth) return false;
+
+			auto const marker = this->data[this->pos++];
+			if (marker < 0x80) return this->visitor.number_unsigned(marker);
+			if (marker >= 0xE0) return this->visitor.number_integer(static_cast<int8_t>(marker));
+			if ((marker & 0xF0) == 0x80) return this->object(marker & 0x0F, depth);
+			if ((marker & 0xF0) == 0x90) return this->array(marker & 0x0F, depth);
+			if ((marker & 0xE0) == 0xA0) return this->readString(marker & 0x1F) && this->visitor.string(this->scratch);
+
+			uint64_t n = 0;
+			switch (marker) {
+			case 0xC0: return this->visitor.null();
+			case 0xC2: return this->visitor.boolean(false);
+			case 0xC3: return this->visitor.boolean(true);
+			case 0xCA:
+				this->scratch.clear();
+				return this->read(4, n) && this->visitor.number_float(std::bit_cast<float>(static_cast<uint32_t>(n)), this->scratch);
+			case 0xCB:
+				this->scratch.clear();
+				return this->read(8, n) && this->visitor.number_float(std::bit_cast<double>(n), this->scratch);
+			case 0xCC: return this->read(1, n) && this->visitor.number_unsigned(n);
+			case 0xCD: return this->read(2, n) && this->visitor.number_unsigned(n);
+			case 0xCE: return this->read(4, n) && this->visitor.number_unsigned(n);
+			case 0xCF: return this->read(8, n) && this->visitor.number_unsigned(n);
+			case 0xD0: return this->read(1, n) && this->visitor.number_integer(static_cast<int8_t>(n));
+			case 0xD1: return this->read(2, n) && this->visitor.number_integer(static_cast<int16_t>(n));
+			case 0xD2: return this->read(4, n) && this->visitor.number_integer(static_cast<int32_t>(n));
+			case 0xD3: return this->read(8, n) && this->visitor.number_integer(static_cast<int64_t>(n));
+			case 0xD9: return this->read(1, n) && this->readString(n) && this->visitor.string(this->scratch);
+			case 0xDA: return this->read(2, n) && this->readString(n) && this->visitor.string(this->scratch);
+			case 0xDB: return this->read(4, n) && this->readString(n) && this->visitor.string(this->scratch);
+			case 0xDC: return this->read(2, n) && this->array(n, depth);
+			case 0xDD: return this->read(4, n) && this->array(n, depth);
+			case 0xDE: return this->read(2, n) && this->object(n, depth);
+			case 0xDF: return this->read(4, n) && this->object(n, depth);
+			// Binary and extension types never come from events.
+			default: return false;
+			}
+		}
+
+		auto atEnd() const -> bool {
+			return this->pos == this->data.size();
+		}
+
+	private:
+		// Deeper than any event, anything this deep is refused rather than recursed into.
+		static constexpr size_t maxDepth = 32;
+
+		auto object(uint64_t size, size_t depth) -> bool {
+			// Every entry takes at least two bytes, so a size beyond that is malformed.
+			if (size > (this->data.size() - this->pos) / 2) return false;
+			if (!this->visitor.start_object(size)) return false;
+			for (uint64_t i = 0; i < size; ++i) {
+				if (!this->key() || !this->value(depth + 1)) return false;
+			}
+			return this->visitor.end_object();
+		}
+
+		auto array(uint64_t size, size_t depth) -> bool {
+			if (size > this->data.size() - this->pos) return false;
+			if (!this->visitor.start_array(size)) return false;
+			for (uint64_t i = 0; i < size; ++i) {
+				if (!this->value(depth + 1)) return false;
+			}
+			return this->visitor.end_array();
+		}
+
+		// Keys have to be strings, as with nlohmann::json.
+		auto key() -> bool {
+			if (this->pos == this->data.size()) return false;
+
+			uint64_t size = 0;
+			auto const marker = this->data[this->pos++];
+			if ((marker & 0xE0) == 0xA0) size = marker & 0x1F;
+			else if (marker == 0xD9) { if (!this->read(1, size)) return false; }
+			else if (marker == 0xDA) { if (!this->read(2, size)) return false; }
+			else if (marker == 0xDB) { if (!this->read(4, size)) return false; }
+			else return false;
+			return this->readString(size) && this->visitor.key(this->scratch);
+		}
+
+		auto readString(uint64_t size) -> bool {
+			if (size > this->data.size() - this->pos) return false;
+			this->scratch.assign(reinterpret_cast<const char*>(this->data.data() + this->pos), size);
+			this->pos += size;
+			return true;
+		}
+
+		// MessagePack is big endian.
+		auto read(size_t size, uint64_t& value) -> bool {
+			if (size > this->data.size() - this->pos) return false;
+			value = 0;
+			for (size_t i = 0; i < size; ++i)
+				value = (value << 8) | this->data[this->pos++];
+			return true;
+		}
+
+		std::span<const uint8_t> data;
+		TVisitor& visitor;
+		size_t pos = 0;
+		std::string& scratch = MessagePackDetail::scratch();
+	};
+}
+
+// Walks one MessagePack value into a visitor the way nlohmann::json::sax_parse would, without allocating. Returns false
+// if the visitor stopped the walk, or the data is malformed, uses binary or extension types, or has anything after the
+// value.
+template<typename TVisitor>
+auto visitMessagePack(std::span<const uint8_t> data, TVisitor& visitor) -> bool {
+	MessagePackDetail::Reader<TVisitor> reader(data, visitor);
+	return reader.value(0) && reader.atEnd();
+}
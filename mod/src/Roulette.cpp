@@ -1,4 +1,5 @@
 #include "Roulette.h"
+#include "KeywordTable.h"
 #include "Target.h"
 #include "util.h"
 #include <string>
@@ -11,7 +12,6 @@ using namespace std::literals::string_literals;
 std::random_device RouletteSpinGenerator::rd;
 std::mt19937 RouletteSpinGenerator::gen(rd());
 std::set<eMethodTag> RouletteTarget::emptyMethodTags;
-std::unordered_map<std::string, Keyword::Variant> Keyword::keywordMap;
 std::unordered_map<std::string, std::string> Keyword::targetKeyMap = {
 	{"Kalvin Ritter", "KR"},
 	{"Jasper Knight", "JK"},
@@ -41,6 +41,7 @@ std::unordered_map<std::string, std::string> Keyword::targetKeyMap = {
 	{"Yuki Yamazaki", "YY"},
 	{"Owen Cage", "OC"},
 	{"Klaus Liebleid", "KL"},
+	{"Dmitri Fedorov", "DF"},
 	{"Alma Reynard", "AR"},
 	{"Sierra Knox", "SK"},
 	{"Robert Knox", "RK"},
@@ -108,6 +109,7 @@ std::unordered_map<eTargetID, std::string> Keyword::targetIDKeyMap = {
 	{eTargetID::YukiYamazaki, "YY"},
 	{eTargetID::OwenCage, "OC"},
 	{eTargetID::KlausLiebleid, "KL"},
+	{eTargetID::DmitriFedorov, "DF"},
 	{eTargetID::AlmaReynard, "AR"},
 	{eTargetID::SierraKnox, "SK"},
 	{eTargetID::RobertKnox, "RK"},
@@ -183,6 +185,7 @@ std::unordered_map<std::string, std::string> Keyword::keyTargetMap = {
 	{"YY", "Yuki Yamazaki"},
 	{"OC", "Owen Cage"},
 	{"KL", "Klaus Liebleid"},
+	{"DF", "Dmitri Fedorov"},
 	{"AR", "Alma Reynard"},
 	{"SK", "Sierra Knox"},
 	{"AJ", "Ajit \"AJ\" Krish"},
@@ -235,6 +238,8 @@ std::unordered_map<std::string, eMission> targetMissionMap = {
 	{"Marco Abiatti", eMission::SAPIENZA_LANDSLIDE},
 	{"Reza Zaydan", eMission::MARRAKESH_GILDEDCAGE},
 	{"Claus Hugo Strandberg", eMission::MARRAKESH_GILDEDCAGE},
+	{"Kong Tuo-Kwang", eMission::MARRAKESH_HOUSEBUILTONSAND},
+	{"Matthieu Mendola", eMission::MARRAKESH_HOUSEBUILTONSAND},
 	{"Jordan Cross", eMission::BANGKOK_CLUB27},
 	{"Ken Morgan", eMission::BANGKOK_CLUB27},
 	{"Oybek Nabazov", eMission::BANGKOK_THESOURCE},
@@ -247,6 +252,7 @@ std::unordered_map<std::string, eMission> targetMissionMap = {
 	{"Yuki Yamazaki", eMission::HOKKAIDO_SITUSINVERSUS},
 	{"Owen Cage", eMission::HOKKAIDO_PATIENTZERO},
 	{"Klaus Liebleid", eMission::HOKKAIDO_PATIENTZERO},
+	{"Dmitri Fedorov", eMission::HOKKAIDO_SNOWFESTIVAL},
 	{"Alma Reynard", eMission::HAWKESBAY_NIGHTCALL},
 	{"Sierra Knox", eMission::MIAMI_FINISHLINE},
 	{"Robert Knox", eMission::MIAMI_FINISHLINE},
@@ -365,7 +371,7 @@ std::map<std::string, eTargetID, InsensitiveCompareLexicographic> targetsByRepoI
 	{"f83376a4-6e56-4f2a-8122-151b272108fd", eTargetID::AgentPrice},
 };
 
-std::vector<Keyword> Keyword::keywords = {
+constexpr Keyword keywordList[] = {
 	// Kill Types
 	{ "Ld", eKillType::Loud },
 	{ "Sil", eKillType::Silenced },
@@ -617,6 +623,19 @@ std::vector<Keyword> Keyword::keywords = {
 	{ "ExplosiveOnTheWater", eMapKillMethod::Steven_BombWaterScooter, "BombWaterScooter" },
 };
 
+const std::span<const Keyword> Keyword::keywords = keywordList;
+
+constexpr auto keywordTable = KeywordTable<Keyword::Variant, std::size(keywordList)>{[]{
+	std::array<KeywordTableView<Keyword::Variant>::Entry, std::size(keywordList)> entries;
+	for (size_t i = 0; i < entries.size(); ++i)
+		entries[i] = {keywordList[i].keyword, keywordList[i].value};
+	return entries;
+}()};
+
+auto Keyword::find(std::string_view keyword) -> const Variant* {
+	return keywordTable.find(keyword);
+}
+
 const std::vector<eKillMethod> RouletteSpinGenerator::standardKillMethods = {
 	eKillMethod::ConsumedPoison,
 	eKillMethod::Drowning,
@@ -7,6 +7,7 @@
 #include <optional>
 #include <random>
 #include <set>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -62,26 +63,25 @@ struct Keyword
 {
 public:
 	using Variant = std::variant<eKillType, eKillMethod, eKillComplication, eMapKillMethod>;
-	static std::vector<Keyword> keywords;
+	static const std::span<const Keyword> keywords;
 
 private:
-	static std::unordered_map<std::string, Variant> keywordMap;
 	static std::unordered_map<std::string, std::string> targetKeyMap;
 	static std::unordered_map<std::string, std::string> keyTargetMap;
 	static std::unordered_map<eTargetID, std::string> targetIDKeyMap;
 
 public:
-	std::string keyword;
+	std::string_view keyword;
 	Variant value;
-	std::string alias = "";
+	std::string_view alias = "";
 
-	Keyword(std::string keyword, eKillType value, std::string alias = "") : keyword(keyword), value(value), alias(alias)
+	constexpr Keyword(std::string_view keyword, eKillType value, std::string_view alias = "") : keyword(keyword), value(value), alias(alias)
 	{ }
-	Keyword(std::string keyword, eKillMethod value, std::string alias = "") : keyword(keyword), value(value), alias(alias)
+	constexpr Keyword(std::string_view keyword, eKillMethod value, std::string_view alias = "") : keyword(keyword), value(value), alias(alias)
 	{ }
-	Keyword(std::string keyword, eMapKillMethod value, std::string alias = "") : keyword(keyword), value(value), alias(alias)
+	constexpr Keyword(std::string_view keyword, eMapKillMethod value, std::string_view alias = "") : keyword(keyword), value(value), alias(alias)
 	{ }
-	Keyword(std::string keyword, Variant value, std::string alias = "") : keyword(keyword), value(value), alias(alias)
+	constexpr Keyword(std::string_view keyword, Variant value, std::string_view alias = "") : keyword(keyword), value(value), alias(alias)
 	{ }
 
 	static auto convertFromSodersKill(eMapKillMethod killMethod) -> Variant {
@@ -93,13 +93,8 @@ public:
 		return killMethod;
 	}
 
-	static auto& getMap() {
-		if (keywordMap.empty()) {
-			for (auto& keyword : keywords)
-				keywordMap.emplace(toLowerCase(keyword.keyword), keyword.value);
-		}
-		return keywordMap;
-	}
+	// Case-insensitive lookup of a keyword in the compile-time keyword table.
+	static auto find(std::string_view keyword) -> const Variant*;
 
 	static auto get(Variant method) -> std::string_view {
 		if (std::holds_alternative<eMapKillMethod>(method))
@@ -0,0 +1,433 @@
+#include "SharedRouletteSpin.h"
+#include "Disguise.h"
+#include "EventSystem.h"
+#include "KillValidation.h"
+#include "Target.h"
+#include <algorithm>
+#include <format>
+
+namespace {
+	auto isBerlinAgent(eTargetID id) -> bool {
+		switch (id) {
+		case eTargetID::Agent1:
+		case eTargetID::Agent2:
+		case eTargetID::Agent3:
+		case eTargetID::Agent4:
+		case eTargetID::Agent5:
+		case eTargetID::Agent6:
+		case eTargetID::Agent7:
+		case eTargetID::Agent8:
+		case eTargetID::Agent9:
+		case eTargetID::Agent10:
+		case eTargetID::Agent11:
+		case eTargetID::AgentBanner:
+		case eTargetID::AgentChamberlin:
+		case eTargetID::AgentDavenport:
+		case eTargetID::AgentGreen:
+		case eTargetID::AgentLowenthal:
+		case eTargetID::AgentMontgomery:
+		case eTargetID::AgentPrice:
+		case eTargetID::AgentRhodes:
+		case eTargetID::AgentSwan:
+		case eTargetID::AgentThames:
+		case eTargetID::AgentTremaine:
+			return true;
+		}
+		return false;
+	}
+}
+
+auto SharedRouletteSpin::listen(EventSystem& events, const KillValidator& validator, ListenHooks hooks) -> void {
+	this->hooks = std::move(hooks);
+
+	events.listen<Events::ContractStart>([this](const ServerEvent<Events::ContractStart>& ev) {
+		this->playerStart();
+		this->locationId = ev.Value.LocationId;
+		this->loadout.assign(ev.Value.Loadout.begin(), ev.Value.Loadout.end());
+		this->validationUpdated();
+	});
+	events.listen<Events::IntroCutEnd>([this](const ServerEvent<Events::IntroCutEnd>& ev) {
+		this->playerCutsceneEnd(ev.Timestamp);
+	});
+	events.listen<Events::ContractLoad>([this](const ServerEvent<Events::ContractLoad>& ev) {
+		this->playerLoad(ev.Timestamp);
+		this->validationUpdated();
+	});
+	events.listen<Events::ExitGate>([this](const ServerEvent<Events::ExitGate>& ev) {
+		this->exit(ev.Timestamp);
+	});
+	events.listen<Events::FacilityExitEvent>([this](const ServerEvent<Events::FacilityExitEvent>& ev) {
+		this->exit(ev.Timestamp);
+	});
+	events.listen<Events::ContractEnd>([this](const ServerEvent<Events::ContractEnd>& ev) {
+		if (!this->isFinished) this->exit(ev.Timestamp);
+	});
+	events.listen<Events::StartingSuit>([this](const ServerEvent<Events::StartingSuit>& ev) {
+		if (this->isIgnoringEvents()) return;
+		this->recordDisguiseChange(ev.Value.value, ev.Timestamp);
+	});
+	events.listen<Events::Disguise>([this](const ServerEvent<Events::Disguise>& ev) {
+		if (this->isIgnoringEvents()) return;
+		this->recordDisguiseChange(ev.Value.value, ev.Timestamp);
+	});
+	events.listen<Events::ItemThrown>([this](const ServerEvent<Events::ItemThrown>& ev) {
+		this->recordItemThrown(ev.Value.RepositoryId, ev.Timestamp);
+	});
+	events.listen<Events::Pacify>([this](const ServerEvent<Events::Pacify>& ev) {
+		if (this->isIgnoringEvents()) return;
+		this->recordPacify(ev);
+	});
+	events.listen<Events::C_Hungry_Hippo>([this](const ServerEvent<Events::C_Hungry_Hippo>& ev) {
+		if (this->isIgnoringEvents()) return;
+		if (this->recordScriptedKill(eMission::SANTAFORTUNA_THREEHEADEDSERPENT, eTargetID::RicoDelgado, eMapKillMethod::Rico_FeedToHippo, ev.Timestamp))
+			this->validationUpdated();
+	});
+	events.listen<Events::TargetEscapeFoiled>([this](const ServerEvent<Events::TargetEscapeFoiled>& ev) {
+		if (this->isIgnoringEvents()) return;
+		if (this->recordScriptedKill(eMission::HOKKAIDO_SITUSINVERSUS, eTargetID::YukiYamazaki, eMapKillMethod::Yuki_SabotageCableCar, ev.Timestamp))
+			this->validationUpdated();
+	});
+	events.listen<Events::Kill>([this, &validator](const ServerEvent<Events::Kill>& ev) {
+		if (this->isIgnoringEvents()) return;
+		if (this->recordKill(ev, validator, this->hooks.log))
+			this->validationUpdated();
+	});
+	events.listen<Events::Level_Setup_Events>([this](const ServerEvent<Events::Level_Setup_Events>& ev) {
+		if (this->isIgnoringEvents()) return;
+		this->recordLevelSetupEvent(ev);
+		if (this->recordSodersKill(ev, this->hooks.log))
+			this->validationUpdated();
+	});
+	events.listen<Events::setpieces>([this](const ServerEvent<Events::setpieces>& ev) {
+		if (this->isIgnoringEvents()) return;
+		this->recordSetpiece(ev);
+	});
+
+	// SA Tracking
+	events.listen<Events::MurderedBodySeen>([this](const ServerEvent<Events::MurderedBodySeen>& ev) {
+		if (ev.Value.IsWitnessTarget) return;
+		this->voidSA();
+	});
+	events.listen<Events::Spotted>([this](const ServerEvent<Events::Spotted>& ev) {
+		for (auto const& id : ev.Value.value) {
+			if (!this->killed.contains(id))
+				this->spottedNotKilled.emplace(id);
+		}
+	});
+	events.listen<Events::SecuritySystemRecorder>([this](const ServerEvent<Events::SecuritySystemRecorder>& ev) {
+		switch (ev.Value.event) {
+			case SecuritySystemRecorderEvent::Spotted:
+				if (this->isCamsDestroyed) return;
+				this->isCaughtOnCams = true;
+				break;
+			case SecuritySystemRecorderEvent::Destroyed:
+				this->isCamsDestroyed = true;
+				this->isCaughtOnCams = false;
+				break;
+			case SecuritySystemRecorderEvent::Erased:
+				this->isCaughtOnCams = false;
+				break;
+		}
+	});
+}
+
+auto SharedRouletteSpin::seeEvent(double timestamp) -> void {
+	if (this->applyPendingLoad(timestamp))
+		this->validationUpdated();
+
+	this->lastEventTimestamp = timestamp;
+	this->lastEventSeen = std::chrono::steady_clock::now();
+}
+
+auto SharedRouletteSpin::getEventClock() const -> double {
+	if (this->lastEventSeen == std::chrono::steady_clock::time_point{}) return this->lastEventTimestamp;
+	auto const sinceEvent = std::chrono::duration<double>(std::chrono::steady_clock::now() - this->lastEventSeen);
+	return this->lastEventTimestamp + std::max(sinceEvent.count(), 0.0);
+}
+
+auto SharedRouletteSpin::playerCameRound(size_t condition) -> void {
+	this->killValidations.cameRound(condition, this->getEventClock());
+}
+
+auto SharedRouletteSpin::exit(double timestamp) -> void {
+	this->playerExit(timestamp);
+
+	// Mark any unfulfilled kill methods as invalid (never killed a Berlin agent with correct requirements, destroyed heart instead of killing Soders or vice-versa, etc.)
+	this->killValidations.complete(timestamp);
+
+	this->validationUpdated();
+	if (this->hooks.onExit) this->hooks.onExit();
+}
+
+auto SharedRouletteSpin::recordDisguiseChange(std::string_view repoId, double timestamp) -> void {
+	this->disguiseChanges.add(DisguiseChange(repoId, timestamp));
+	this->compactTimelines(timestamp);
+}
+
+auto SharedRouletteSpin::recordItemThrown(std::string_view repoId, double timestamp) -> void {
+	this->itemThrows.add({std::string(repoId), timestamp});
+	this->compactTimelines(timestamp);
+}
+
+auto SharedRouletteSpin::recordSetpiece(const ServerEvent<Events::setpieces>& ev) -> void {
+	KillSetpieceEvent data{};
+	data.id = ev.Value.RepositoryId;
+	data.name = ev.Value.name_metricvalue;
+	data.type = ev.Value.setpieceType_metricvalue;
+	data.timestamp = ev.Timestamp;
+	this->killSetpieceEvents.add(std::move(data));
+	this->compactTimelines(ev.Timestamp);
+}
+
+auto SharedRouletteSpin::recordLevelSetupEvent(const ServerEvent<Events::Level_Setup_Events>& ev) -> void {
+	LevelSetupEvent data {};
+	//data.contractName = ev.Value.Contract_Name_metricvalue;
+	//data.location = ev.Value.Location_MetricValue;
+	data.event = ev.Value.Event_metricvalue;
+	data.timestamp = ev.Timestamp;
+	this->levelSetupEvents.add(std::move(data));
+	this->compactTimelines(ev.Timestamp);
+}
+
+auto SharedRouletteSpin::compactTimelines(double timestamp) -> void {
+	auto const horizon = timestamp - timelineLookBack;
+	this->disguiseChanges.compactBefore(horizon);
+	this->itemThrows.compactBefore(horizon);
+	this->killSetpieceEvents.compactBefore(horizon);
+	this->levelSetupEvents.compactBefore(horizon);
+}
+
+auto SharedRouletteSpin::recordPacify(const ServerEvent<Events::Pacify>& ev) -> void {
+	if (!ev.Value.IsTarget) return;
+
+	auto const& conditions = this->spin.getConditions();
+	if (conditions.empty()) return;
+
+	auto targetId = GetTargetByRepoID(std::string(ev.Value.RepositoryId));
+	this->syncKillValidations();
+
+	for (auto i = 0; i < conditions.size(); ++i) {
+		auto& cond = conditions[i];
+		auto& target = cond.target.get();
+
+		if (targetId != target.getID() && target.getName() != std::string_view(ev.Value.ActorName))
+			continue;
+
+		// If this pacification is a throw and the last thrown item is an impact explosive, ignore
+		// this as a pacification so lethal throws with impact explosives pass the 'live' condition.
+		if (ev.Value.KillMethodBroad == eKillMethodBroad::Throw && cond.killType == eKillType::Impact) {
+			auto const lastThrow = this->itemThrows.latest();
+			if (lastThrow && checkExplosiveKillType(lastThrow->repoId, eKillType::Impact)) return;
+		}
+
+		this->killValidations.pacify(i, target.getID(), ev.Timestamp);
+	}
+}
+
+auto SharedRouletteSpin::recordKill(const ServerEvent<Events::Kill>& ev, const KillValidator& validator, const LogFunc& log) -> bool {
+	this->killed.emplace(ev.Value.RepositoryId);
+	this->spottedNotKilled.erase(std::string(ev.Value.RepositoryId));
+
+	if (!ev.Value.IsTarget) {
+		if (ev.Value.KillContext != EDeathContext::eDC_NOT_HERO)
+			this->voidSA();
+		return false;
+	}
+
+	auto const& conditions = this->spin.getConditions();
+	if (conditions.empty()) return false;
+
+	bool validationUpdated = false;
+	auto const killFacts = KillEventFacts(ev.Value, ev.Timestamp);
+	auto it = targetsByRepoId.find(ev.Value.RepositoryId);
+	auto targetId = it != end(targetsByRepoId) ? it->second : eTargetID::Unknown;
+
+	for (auto i = 0; i < conditions.size(); ++i) {
+		auto const& cond = conditions[i];
+		auto const& target = cond.target.get();
+		bool isApexPrey = isBerlinAgent(target.getID()) && isBerlinAgent(targetId);
+		auto kc = this->getKillConfirmation(i);
+
+		if (isApexPrey) {
+			if (kc.correctMethod != eKillValidationType::Incomplete)
+				continue;
+		}
+		else if (targetId != target.getID() && target.getName() != std::string_view(ev.Value.ActorName))
+			continue;
+
+		auto const outfitRepoId = std::string(ev.Value.OutfitRepositoryId);
+		auto disguiseRepoId = ev.Value.OutfitIsHitmanSuit ? outfitRepoId : transformDisguiseVariantRepoId(outfitRepoId);
+		auto& reqDisguise = cond.disguise.get();
+		kc.target = target.getID();
+
+		// Target already killed? Confusion. Turn an invalid kill valid, but don't invalidate previously validated kills.
+		if (kc.correctMethod == eKillValidationType::Valid) {
+			if (!kc.correctDisguise) {
+				kc.correctDisguise = reqDisguise.any || (reqDisguise.suit ? ev.Value.OutfitIsHitmanSuit : reqDisguise.repoId == disguiseRepoId);
+				this->killValidations.kill(i, kc, ev.Timestamp);
+				validationUpdated = true;
+			}
+			break;
+		}
+
+		kc.correctDisguise = reqDisguise.any || (reqDisguise.suit ? ev.Value.OutfitIsHitmanSuit : reqDisguise.repoId == disguiseRepoId);
+
+		if (!kc.correctDisguise && !reqDisguise.suit && log) {
+			log(std::format("Invalid disguise '{}' (expected: '{}')", disguiseRepoId, reqDisguise.repoId));
+		}
+
+		if (cond.killComplication == eKillComplication::Live && kc.isPacified) {
+			kc.correctMethod = eKillValidationType::Invalid;
+
+			if (log) log("Invalid kill, target was KO'd on death");
+		}
+		else if (cond.killMethod.method != eKillMethod::NONE) {
+			kc.correctMethod = validator.validate(target.getID(), killFacts, cond.killMethod.method, cond.killType, *this).result;
+			if (kc.correctMethod != eKillValidationType::Valid && log) {
+				log(std::format("Invalid kill '{}' (type: {})", cond.killMethod.name, static_cast<int>(cond.killType)));
+				log(ev.toJson().dump());
+			}
+		}
+		else if (cond.specificKillMethod.method != eMapKillMethod::NONE) {
+			auto validation = validator.validate(target.getID(), killFacts, cond.specificKillMethod.method, cond.killType, *this);
+			kc.correctMethod = validation.result;
+			if (validation.rule && !validation.rule->reason.empty() && log) {
+				log(std::format("Invalid kill '{}', {} (KillMethodBroad '{}').", ev.Value.KillItemRepositoryId, validation.rule->reason, getEventStringName(killMethodBroadTable, ev.Value.KillMethodBroad)));
+				log(ev.toJson().dump());
+			}
+		}
+
+		if (isApexPrey) {
+			// If we're in an unspecified target mode, replace invalidations with incompletes
+			if (!kc.correctDisguise || kc.correctMethod == eKillValidationType::Invalid) {
+				kc.correctMethod = eKillValidationType::Incomplete;
+				this->killValidations.kill(i, kc, ev.Timestamp);
+				continue;
+			}
+
+			// Fill in the info of the specific target killed
+			kc.specificTarget = targetId;
+		}
+
+		this->killValidations.kill(i, kc, ev.Timestamp);
+		validationUpdated = true;
+	}
+	return validationUpdated;
+}
+
+auto SharedRouletteSpin::recordSodersKill(const ServerEvent<Events::Level_Setup_Events>& ev, const LogFunc& log) -> bool {
+	auto const& conditions = this->spin.getConditions();
+	auto mission = this->spin.getMission();
+
+	if (!mission || mission->getMission() != eMission::HOKKAIDO_SITUSINVERSUS) return false;
+	if (ev.Value.Contract_Name_metricvalue != "SnowCrane") return false;
+
+	bool validationUpdated = false;
+
+	for (auto i = 0; i < conditions.size(); ++i) {
+		auto& cond = conditions[i];
+		if (cond.target.get().getID() != eTargetID::ErichSoders) continue;
+
+		auto kc = this->getKillConfirmation(i);
+		auto& reqDisguise = cond.disguise.get();
+		kc.target = cond.target.get().getID();
+
+		// SnowCrane events that aren't Soders' death leave the condition as it was.
+		bool decided = true;
+
+		auto getSodersKillDelay = [](std::string_view kill) -> double {
+			if (kill == "Body_Kill") return 4;
+			if (kill == "Soder_Electrocuted") return 8;
+			if (kill == "Poison_Kill") return 12;
+			if (kill == "Spidermachine_Kill") return 13;
+			return 0;
+		};
+		auto getSodersKillTriggerDisguiseChange = [this, getSodersKillDelay](std::string_view kill, double timestamp) -> const DisguiseChange* {
+			auto const delay = getSodersKillDelay(kill);
+			return this->getLastDisguiseChangeAtTimestamp(timestamp - delay);
+		};
+
+		auto const triggerDisguiseChange = getSodersKillTriggerDisguiseChange(ev.Value.Event_metricvalue, ev.Timestamp);
+
+		// There should be at least one disguise. If in doubt, trust the player...
+		if (!triggerDisguiseChange)
+			kc.correctDisguise = true;
+		// If we're not looking for a suit, just compare repo IDs
+		else if (!reqDisguise.suit)
+			kc.correctDisguise = toLowerCase(triggerDisguiseChange->disguiseRepoId) == reqDisguise.repoId;
+		// If it is suit, just check the repo ID does not match any non-suit disguises in the level (player-unlocked suit IDs are vast)
+		else {
+			auto isNotInSuit = false;
+			for (auto const& disguise : mission->getDisguises()) {
+				if (disguise.suit) continue;
+				if (disguise.repoId != triggerDisguiseChange->disguiseRepoId) continue;
+				isNotInSuit = true;
+				break;
+			}
+
+			kc.correctDisguise = !isNotInSuit;
+		}
+
+		if (!kc.correctDisguise && !reqDisguise.suit && log) {
+			log(std::format("Invalid disguise '{}' (expected: '{}')", triggerDisguiseChange->disguiseRepoId, reqDisguise.repoId));
+		}
+
+		if (cond.specificKillMethod.method != eMapKillMethod::NONE) {
+			if (ev.Value.Event_metricvalue == "Heart_Kill")
+				kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_TrashHeart
+					|| cond.specificKillMethod.method == eMapKillMethod::Soders_ShootHeart
+					? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Spidermachine_Kill")
+				kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_RobotArms ? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Soder_Electrocuted")
+				kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_Electrocution ? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Poison_Kill")
+				kc.correctMethod = cond.specificKillMethod.method == eMapKillMethod::Soders_PoisonStemCells ? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else
+				decided = false;
+		}
+		else if (cond.killMethod.method != eKillMethod::NONE) {
+			if (ev.Value.Event_metricvalue == "Body_Kill")
+				kc.correctMethod = cond.killMethod.isGun
+					|| cond.killMethod.method == eKillMethod::Explosive
+					|| cond.killMethod.method == eKillMethod::Explosion
+					? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Heart_Kill")
+				kc.correctMethod = eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Spidermachine_Kill")
+				kc.correctMethod = eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Soder_Electrocuted")
+				kc.correctMethod = cond.killMethod.method == eKillMethod::Electrocution ? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else if (ev.Value.Event_metricvalue == "Poison_Kill")
+				kc.correctMethod = cond.killMethod.method == eKillMethod::ConsumedPoison ? eKillValidationType::Valid : eKillValidationType::Invalid;
+			else
+				decided = false;
+		}
+		else decided = false;
+
+		if (!decided) continue;
+		this->killValidations.kill(i, kc, ev.Timestamp);
+		validationUpdated = true;
+	}
+
+	return validationUpdated;
+}
+
+auto SharedRouletteSpin::recordScriptedKill(eMission mission, eTargetID target, eMapKillMethod method, double timestamp) -> bool {
+	auto const spinMission = this->spin.getMission();
+	if (!spinMission || spinMission->getMission() != mission) return false;
+
+	auto const& conditions = this->spin.getConditions();
+	for (auto i = 0; i < conditions.size(); ++i) {
+		auto const& cond = conditions[i];
+		if (cond.target.get().getID() != target) continue;
+		if (cond.specificKillMethod.method != method) return false;
+
+		auto kc = this->getKillConfirmation(i);
+		kc.target = target;
+		kc.correctMethod = eKillValidationType::Valid;
+		this->killValidations.kill(i, kc, timestamp);
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,278 @@
+#pragma once
+#include "Events.h"
+#include "EventTimeline.h"
+#include "KillConfirmation.h"
+#include "KillValidationState.h"
+#include "Roulette.h"
+#include "util.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class EventSystem;
+class KillValidator;
+
+struct KillSetpieceEvent {
+	std::string id;
+	std::string name;
+	std::string type;
+	double timestamp;
+};
+
+struct ItemThrowEvent {
+	std::string repoId;
+	double timestamp;
+};
+
+struct LevelSetupEvent {
+	//std::string contractName;
+	//std::string location;
+	std::string event;
+	double timestamp;
+};
+
+struct SharedRouletteSpin {
+	const RouletteSpin& spin;
+	std::set<std::string, InsensitiveCompareLexicographic> killed;
+	std::set<std::string, InsensitiveCompareLexicographic> spottedNotKilled;
+	EventTimeline<DisguiseChange> disguiseChanges;
+	KillValidationState killValidations;
+	NamedEventTimeline<KillSetpieceEvent, &KillSetpieceEvent::name> killSetpieceEvents;
+	NamedEventTimeline<LevelSetupEvent, &LevelSetupEvent::event> levelSetupEvents;
+	std::vector<LoadoutItemEventValue> loadout;
+	// The last of these is for telling lethal impact explosive throws from pacifying ones.
+	EventTimeline<ItemThrowEvent> itemThrows;
+	std::string locationId;
+	std::chrono::steady_clock::time_point timeStarted;
+	std::chrono::seconds timeElapsed = std::chrono::seconds(0);
+	double startIGT = 0;
+	double exitIGT = 0;
+	bool isSA = true;
+	bool isCaughtOnCams = false;
+	bool isCamsDestroyed = false;
+	bool isPlaying = false;
+	bool isFinished = false;
+	bool hasLoadedGame = false;		// current play session is from a loaded game, so SA can't be tracked
+	long windowX = 0;
+	long windowY = 0;
+
+	SharedRouletteSpin(const RouletteSpin& spin) : spin(spin), timeElapsed(0) {
+		timeStarted = std::chrono::steady_clock().now();
+		this->resetKillValidations();
+	}
+
+	// Receives the reasons kills fail validation.
+	using LogFunc = std::function<void(std::string_view)>;
+
+	// How the listeners added by listen() report back to whoever owns the spin.
+	struct ListenHooks {
+		LogFunc log;
+		// Called when kill confirmations may have changed.
+		std::function<void()> onValidationUpdate;
+		// Called once the player's left the mission, after onValidationUpdate.
+		std::function<void()> onExit;
+		// Events that would change kill validation are ignored while this returns true, e.g. once the spin's completed.
+		std::function<bool()> isIgnoring;
+	};
+
+	// Kills are validated as their events arrive, looking back at most this many seconds (for Soders' kills), so timeline
+	// entries from before then are only needed for what was still true at the time.
+	static constexpr double timelineLookBack = 30;
+
+	// Adds the listeners that track the spin and validate its kills, shared by the mod and the tools that replay recorded
+	// sessions so both validate alike. Listeners for anything else should be added after these. They point back to this
+	// spin, so it mustn't move while `events` is in use.
+	auto listen(EventSystem& events, const KillValidator& validator, ListenHooks hooks = {}) -> void;
+	// Has to be given the timestamp of every event before it's handled, whether it's listened to or not, or at least of
+	// the first event after a ContractLoad. That's the first time known to be from the loaded save's clock.
+	auto seeEvent(double timestamp) -> void;
+	// The time on the game's event clock now, going by the last event seen and how long ago that was.
+	auto getEventClock() const -> double;
+	// A KO'd target's actor was seen up, which no event reports, so it's journaled at the event clock's time.
+	auto playerCameRound(size_t condition) -> void;
+
+	auto recordDisguiseChange(std::string_view repoId, double timestamp) -> void;
+	auto recordItemThrown(std::string_view repoId, double timestamp) -> void;
+	auto recordSetpiece(const ServerEvent<Events::setpieces>& ev) -> void;
+	auto recordLevelSetupEvent(const ServerEvent<Events::Level_Setup_Events>& ev) -> void;
+	auto recordPacify(const ServerEvent<Events::Pacify>& ev) -> void;
+	// Validates a target kill against each condition for the target. Returns whether any kill confirmation changed.
+	auto recordKill(const ServerEvent<Events::Kill>& ev, const KillValidator& validator, const LogFunc& log = {}) -> bool;
+	// Validates the Soders kill a SnowCrane level setup event stands for. Returns whether any kill confirmation changed.
+	auto recordSodersKill(const ServerEvent<Events::Level_Setup_Events>& ev, const LogFunc& log = {}) -> bool;
+	// Validates a kill that's only reported by a scripted event on the mission, if the target's condition is the map
+	// method. Returns whether the kill confirmation changed.
+	auto recordScriptedKill(eMission mission, eTargetID target, eMapKillMethod method, double timestamp) -> bool;
+	// Drops timeline entries no validation can look back to from an event at the timestamp.
+	auto compactTimelines(double timestamp) -> void;
+
+	auto getTargetKillValidation(eTargetID target) const -> KillConfirmation {
+		//if (hasLoadedGame) return KillConfirmation(target, eKillValidationType::Unknown);
+		for (auto& kc : killValidations) {
+			if (kc.target == target)
+				return kc;
+		}
+		return KillConfirmation(target, eKillValidationType::Incomplete);
+	}
+
+	auto isAnyTargetPacified() const -> bool {
+		for (auto& kc : killValidations) {
+			if (kc.isPacified) return true;
+		}
+		return false;
+	}
+
+	// Starts kill validation over if the spin's gained conditions.
+	auto syncKillValidations() -> void {
+		if (killValidations.size() < spin.getConditions().size())
+			this->resetKillValidations();
+	}
+
+	// Kill confirmations are only changed through killValidations' transitions.
+	auto getKillConfirmation(size_t idx) -> const KillConfirmation& {
+		this->syncKillValidations();
+		if (idx >= killValidations.size()) throw std::out_of_range("Invalid kill confirmation index.");
+		return killValidations[idx];
+	}
+
+	auto getLastDisguiseChangeAtTimestamp(float timestamp) const -> const DisguiseChange* {
+		return disguiseChanges.lastBefore(timestamp);
+	}
+
+	auto getSetpieceByName(std::string_view name) const -> const KillSetpieceEvent* {
+		return killSetpieceEvents.latestNamed(name);
+	}
+
+	auto getSetpieceEventAtTimestamp(double timestamp, double margin = 0.1) const -> const KillSetpieceEvent* {
+		return killSetpieceEvents.latestWithin(timestamp, margin);
+	}
+
+	auto getLevelSetupEventByEvent(std::string_view name) const -> const LevelSetupEvent* {
+		return levelSetupEvents.latestNamed(name);
+	}
+
+	auto getLevelSetupEventAtTimestamp(double timestamp, double margin = 0.1) const -> const LevelSetupEvent* {
+		return levelSetupEvents.latestWithin(timestamp, margin);
+	}
+
+	auto getLastDisguiseChange() const -> const DisguiseChange* {
+		return disguiseChanges.latest();
+	}
+
+	auto getTimeElapsed() const -> std::chrono::seconds {
+		if (!this->isFinished && this->isPlaying) {
+			return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock().now() - timeStarted);
+		}
+		return this->isFinished ? this->timeElapsed : std::chrono::seconds::zero();
+	}
+
+	auto voidSA() {
+		if (this->isFinished) return;
+		this->isSA = false;
+	}
+
+	auto playerSelectMission() {
+		this->isPlaying = false;
+		this->isFinished = false;
+	}
+
+	auto playerStart() {
+		this->resetKillValidations();
+
+		if (!this->isPlaying) {
+			this->isPlaying = true;
+			this->timeStarted = std::chrono::steady_clock().now();
+			this->isFinished = false;
+		}
+
+		this->killed.clear();
+		this->spottedNotKilled.clear();
+		this->exitIGT = 0;
+		this->isSA = true;
+		this->isCaughtOnCams = false;
+		this->isCamsDestroyed = false;
+		this->hasLoadedGame = false;
+	}
+
+	auto playerCutsceneEnd(double igt) {
+		this->startIGT = igt;
+		this->isPlaying = true;
+	}
+
+	// Kill validation is rewound to the time the loaded save was made when the next event of any kind is seen, see
+	// applyPendingLoad. SA tracking isn't journaled, so the spotted targets, kills and camera state from after the save
+	// can't be rewound and may be wrong either way, e.g. a recorder destroyed after the save would clear footage the game
+	// still has. So a run with a load can't be called SA.
+	auto playerLoad(double timestamp) {
+		this->isPlaying = true;
+		this->hasLoadedGame = true;
+
+		if (killValidations.size() != spin.getConditions().size()) {
+			this->resetKillValidations();
+			return;
+		}
+
+		this->pendingLoadTimestamp = timestamp;
+	}
+
+	// Rewinds to the loaded save at the first event after the load, before it's handled. Returns whether it did. ContractLoad
+	// may be timed before the game clock is restored from the save, but the first event after it is timed by the restored
+	// clock, so the earlier of the two is as late as the save can have been.
+	auto applyPendingLoad(double timestamp) -> bool {
+		if (!this->pendingLoadTimestamp) return false;
+		auto const saveTimestamp = std::min(*this->pendingLoadTimestamp, timestamp);
+		this->pendingLoadTimestamp.reset();
+
+		killValidations.restoreAt(saveTimestamp);
+		disguiseChanges.truncateAfter(saveTimestamp);
+		itemThrows.truncateAfter(saveTimestamp);
+		killSetpieceEvents.truncateAfter(saveTimestamp);
+		levelSetupEvents.truncateAfter(saveTimestamp);
+		return true;
+	}
+
+	auto playerExit(double timestamp = 0) {
+		this->timeElapsed = this->getTimeElapsed();
+		this->isPlaying = false;
+		this->isFinished = true;
+		if (this->spottedNotKilled.size() > 0)
+			this->isSA = false;
+		this->exitIGT = timestamp - this->startIGT;
+		this->isSA = this->isSA && !this->isCaughtOnCams && !this->hasLoadedGame;
+		this->killed.clear();
+		this->spottedNotKilled.clear();
+	}
+
+	auto resetKillValidations() -> void {
+		pendingLoadTimestamp.reset();
+		killValidations.reset(spin.getConditions().size());
+		disguiseChanges.clear();
+		itemThrows.clear();
+		killSetpieceEvents.clear();
+		levelSetupEvents.clear();
+	}
+
+private:
+	auto isIgnoringEvents() const -> bool {
+		return this->hooks.isIgnoring && this->hooks.isIgnoring();
+	}
+
+	auto validationUpdated() const -> void {
+		if (this->hooks.onValidationUpdate) this->hooks.onValidationUpdate();
+	}
+
+	// Shared by the exit events, which end the mission the same way.
+	auto exit(double timestamp) -> void;
+
+	ListenHooks hooks;
+	// Timestamp of the ContractLoad event of a load not yet rewound to.
+	std::optional<double> pendingLoadTimestamp;
+	double lastEventTimestamp = 0;
+	std::chrono::steady_clock::time_point lastEventSeen;
+};
@@ -0,0 +1,78 @@
+#include "SpinImport.h"
+#include "SpinParser.h"
+#include "util.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+namespace {
+	// Lines are handed out to workers in blocks this size to keep contention on the shared counter low.
+	constexpr size_t linesPerBlock = 64;
+
+	// Parses without the shared cache, which would serialise the workers on its lock and have a bulk import evict the
+	// spins the client keeps sending.
+	auto importLine(SpinImportResult& result) -> void {
+		try {
+			result.spin = SpinParser::parse(result.text, &result.error);
+			if (!result.ok() && result.error.empty())
+				result.error = "Could not parse spin.";
+		}
+		catch (const std::exception& ex) {
+			result.spin.reset();
+			result.error = ex.what();
+		}
+	}
+}
+
+auto importSpins(std::string_view text, unsigned threads) -> std::vector<SpinImportResult> {
+	std::vector<SpinImportResult> results;
+	size_t lineNumber = 0;
+
+	for (size_t pos = 0; pos <= text.size(); ) {
+		auto end = text.find('\n', pos);
+		if (end == text.npos) end = text.size();
+		++lineNumber;
+
+		auto line = trim(text.substr(pos, end - pos));
+		if (!line.empty()) {
+			auto& result = results.emplace_back();
+			result.line = lineNumber;
+			result.text = line;
+		}
+		pos = end + 1;
+	}
+
+	if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+	auto numBlocks = (results.size() + linesPerBlock - 1) / linesPerBlock;
+	threads = static_cast<unsigned>(std::min<size_t>(threads, numBlocks));
+
+	if (threads <= 1) {
+		for (auto& result : results)
+			importLine(result);
+		return results;
+	}
+
+	// Build the shared keyword index up front rather than having every worker wait on it.
+	getSpinKeywordTrie();
+
+	std::atomic<size_t> nextBlock = 0;
+	auto worker = [&results, &nextBlock, numBlocks] {
+		for (auto block = nextBlock++; block < numBlocks; block = nextBlock++) {
+			auto first = block * linesPerBlock;
+			auto last = std::min(first + linesPerBlock, results.size());
+			for (auto i = first; i < last; ++i)
+				importLine(results[i]);
+		}
+	};
+
+	{
+		std::vector<std::jthread> workers;
+		workers.reserve(threads - 1);
+		for (unsigned i = 1; i < threads; ++i)
+			workers.emplace_back(worker);
+		worker();
+	}
+
+	return results;
+}
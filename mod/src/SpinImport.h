@@ -0,0 +1,20 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Roulette.h"
+
+struct SpinImportResult {
+	size_t line = 0;
+	std::string_view text;
+	std::optional<RouletteSpin> spin;
+	std::string error;
+
+	auto ok() const -> bool { return this->spin && this->spin->getMission(); }
+};
+
+// Parses each non-empty line of `text` as a spin, spreading the lines across worker threads.
+// Results are in input order, one per non-empty line, with `line` numbered from 1 and `text` viewing into `text`.
+// `threads` of 0 uses the hardware concurrency.
+auto importSpins(std::string_view text, unsigned threads = 0) -> std::vector<SpinImportResult>;
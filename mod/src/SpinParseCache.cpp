@@ -0,0 +1,68 @@
+#include "SpinParseCache.h"
+#include <array>
+
+namespace {
+	// FNV-1a over the raw bytes of the input.
+	auto hashInput(std::string_view input) -> uint64_t {
+		auto hash = uint64_t{0xCBF29CE484222325};
+		for (auto c : input)
+			hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3;
+		return hash;
+	}
+}
+
+auto SpinParseCache::parse(std::string_view input, std::string* error) -> std::optional<RouletteSpin> {
+	auto hash = hashInput(input);
+	std::array<ParseConditionContext, SpinParser::maxConditions> contexts;
+	size_t numContexts = 0;
+
+	auto guard = std::unique_lock(this->mutex);
+	auto it = this->index.find(hash);
+	if (it != this->index.end() && it->second->input == input) {
+		this->entries.splice(this->entries.begin(), this->entries, it->second);
+		auto& entry = this->entries.front();
+		numContexts = entry.contexts.size();
+		std::copy(entry.contexts.begin(), entry.contexts.end(), contexts.begin());
+		guard.unlock();
+		return SpinParser::createSpinFromParseContexts(std::span{contexts}.first(numContexts), error);
+	}
+
+	// Parse outside the lock so threads parsing different spins don't wait on each other.
+	guard.unlock();
+	numContexts = SpinParser::parseContexts(input, contexts, error);
+	if (!numContexts) return nullptr;
+	auto spin = SpinParser::createSpinFromParseContexts(std::span{contexts}.first(numContexts), error);
+	if (!spin || !spin->getMission()) return spin;
+
+	guard.lock();
+	it = this->index.find(hash);
+	if (it != this->index.end()) {
+		// Either another thread got here first or the hash collided, the newer input takes the slot either way.
+		this->entries.erase(it->second);
+		this->index.erase(it);
+	}
+	else if (this->entries.size() >= this->capacity) {
+		this->index.erase(this->entries.back().hash);
+		this->entries.pop_back();
+	}
+
+	this->entries.push_front({hash, std::string(input), {contexts.begin(), contexts.begin() + numContexts}});
+	this->index.emplace(hash, this->entries.begin());
+	return spin;
+}
+
+auto SpinParseCache::clear() -> void {
+	auto guard = std::lock_guard(this->mutex);
+	this->entries.clear();
+	this->index.clear();
+}
+
+auto SpinParseCache::size() const -> size_t {
+	auto guard = std::lock_guard(this->mutex);
+	return this->entries.size();
+}
+
+auto parseSpinCached(std::string_view input, std::string* error) -> std::optional<RouletteSpin> {
+	static SpinParseCache cache;
+	return cache.parse(input, error);
+}
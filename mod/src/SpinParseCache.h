@@ -0,0 +1,46 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Roulette.h"
+#include "SpinParser.h"
+
+// Bounded LRU cache of parsed spins keyed by the raw input text, so spins that are sent or loaded repeatedly skip
+// normalisation and keyword matching. Entries keep the parsed condition contexts, which only view static keyword
+// data, and build the spin from them on each hit. Failed parses aren't cached, so garbage input can't push out good
+// entries. Safe to share between threads.
+class SpinParseCache
+{
+public:
+	static constexpr size_t defaultCapacity = 256;
+
+	SpinParseCache(size_t capacity = defaultCapacity) : capacity(std::max<size_t>(capacity, 1))
+	{}
+
+	// Same as SpinParser::parse, but returns the cached result for input that has been parsed before.
+	auto parse(std::string_view input, std::string* error = nullptr) -> std::optional<RouletteSpin>;
+	auto clear() -> void;
+	auto size() const -> size_t;
+
+private:
+	struct Entry {
+		uint64_t hash;
+		std::string input;
+		std::vector<ParseConditionContext> contexts;
+	};
+
+	// Most recently used first.
+	std::list<Entry> entries;
+	std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+	size_t capacity;
+	mutable std::mutex mutex;
+};
+
+// Parses a spin through the shared cache.
+auto parseSpinCached(std::string_view input, std::string* error = nullptr) -> std::optional<RouletteSpin>;
@@ -1,26 +1,38 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
 #include <vector>
+#include "KeywordTable.h"
+#include "KeywordTrie.h"
 #include "Roulette.h"
+#include "TextNormalizer.h"
 
-namespace {
-	struct KeywordInitialiser {
-		static const KeywordInitialiser inst;
+// Set of missions a group of keywords applies to, empty meaning all missions.
+struct MissionSet {
+	uint64_t bits = 0;
 
-		KeywordInitialiser();
-	};
-}
+	constexpr MissionSet(std::initializer_list<eMission> missions = {}) {
+		for (auto mission : missions)
+			bits |= uint64_t{1} << static_cast<int>(mission);
+	}
 
-struct DisguiseKeywords {
-	std::unordered_set<eMission> missions;
-	std::unordered_map<std::string, std::string> keywords;
+	constexpr auto empty() const { return bits == 0; }
+	constexpr auto contains(eMission mission) const { return ((bits >> static_cast<int>(mission)) & 1) != 0; }
+};
 
-	DisguiseKeywords(std::unordered_set<eMission> missions = {}, std::unordered_map<std::string, std::string> keywords = {}) : missions(missions), keywords(keywords)
-	{ }
+static_assert(static_cast<int>(eMission::AMBROSE_SHADOWSINTHEWATER) < 64, "MissionSet needs more bits");
+
+struct DisguiseKeywords {
+	MissionSet missions;
+	KeywordTableView<std::string_view> keywords;
 };
 struct MethodKeywords {
 	std::unordered_set<eMission> missions;
@@ -30,50 +42,53 @@ struct MethodKeywords {
 	{ }
 };
 
-extern std::unordered_map<std::string, std::string> targetKeywords;
-extern const std::unordered_map<std::string, eKillComplication> complicationKeywords;
-extern const std::unordered_map<std::string, eKillType> killTypeKeywords;
-extern const std::unordered_map<std::string, std::string> keywordKeywords;
-extern const std::unordered_map<std::string, std::string> methodKeywords;
-extern const std::vector<DisguiseKeywords> disguiseKeywords;
-inline std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-
-inline std::string processInput(std::string_view input) {
-	auto wideInput = converter.from_bytes(input.data());
-	auto classicLocale = std::locale("C");
-
-	std::string result;
-	for (wchar_t wch : wideInput) {
-		auto& facet = std::use_facet<std::ctype<wchar_t>>(classicLocale);
-		if (!facet.is(facet.alnum | facet.space, wch)) continue;
-		if (wch == 0xFC) result += 'u';
-		else result += facet.tolower(facet.narrow(wch, ' '));
-	}
+extern const KeywordTableView<std::string_view> targetKeywords;
+extern const KeywordTableView<eKillComplication> complicationKeywords;
+extern const KeywordTableView<eKillType> killTypeKeywords;
+extern const KeywordTableView<std::string_view> keywordKeywords;
+extern const KeywordTableView<std::string_view> methodKeywords;
+extern const std::span<const DisguiseKeywords> disguiseKeywords;
+
+// Everything a normalised keyword can mean to the parser, merged from the keyword tables above.
+struct SpinKeyword {
+	std::string_view target;
+	std::string_view targetName;
+	eMission targetMission = eMission::NONE;
+	std::optional<Keyword::Variant> keyword;
+	std::string_view methodAlias;
+	std::vector<std::pair<size_t, std::string_view>> disguises;
+};
 
-	return removeDiacritics(result);
-}
+auto getSpinKeywordTrie() -> const KeywordTrie<SpinKeyword>&;
+
+struct SpinToken {
+	std::string_view text;
+	bool consumed = false;
+};
 
 struct ParseConditionContext {
-	std::vector<std::string>& tokens;
-	size_t conditions = 0;
-	size_t nextIndex = 0;
 	eMission mission = eMission::NONE;
-	std::string target;
-	std::string disguise;
+	std::string_view target;
+	std::string_view disguise;
 	eKillMethod killMethod = eKillMethod::NONE;
 	eMapKillMethod mapMethod = eMapKillMethod::NONE;
 	eKillType killType = eKillType::Any;
 	eKillComplication complication = eKillComplication::None;
-
-	ParseConditionContext(std::vector<std::string>& tokens) : tokens(tokens) {};
 };
 
 class SpinParser {
 public:
-	static auto createSpinFromParseContexts(const std::vector<ParseConditionContext>& contexts) -> std::optional<RouletteSpin> {
-		if (contexts.empty()) return nullptr;
-		auto mission = Missions::get(contexts.front().mission);
-		if (!mission) return nullptr;
+	// Spins are parsed in stack buffers of these sizes, only falling back to the heap for oversized input.
+	static constexpr size_t maxStackInput = 1024;
+	static constexpr size_t maxStackTokens = 256;
+	static constexpr size_t maxConditions = 16;
+
+	static auto createSpinFromParseContexts(std::span<const ParseConditionContext> contexts, std::string* error = nullptr) -> std::optional<RouletteSpin> {
+		auto mission = contexts.empty() ? nullptr : Missions::get(contexts.front().mission);
+		if (!mission) {
+			if (error) *error = "Could not determine the mission.";
+			return nullptr;
+		}
 
 		RouletteSpin spin(mission);
 
@@ -81,12 +96,18 @@ public:
 			auto it = find_if(begin(contexts), end(contexts), [&target](const ParseConditionContext& ctx) {
 				return ctx.target == target.getName();
 			});
-			if (it == end(contexts)) return nullptr;
+			if (it == end(contexts)) {
+				if (error) *error = std::format("No condition for target '{}'.", target.getName());
+				return nullptr;
+			}
 
 			auto& context = *it;
 			auto disguise = mission->getDisguiseByName(context.disguise);
 			if (!disguise) disguise = mission->getSuitDisguise();
-			if (!disguise) return nullptr;
+			if (!disguise) {
+				if (error) *error = std::format("No disguise for target '{}'.", target.getName());
+				return nullptr;
+			}
 			auto killMethod = context.killMethod;
 			auto mapMethod = context.mapMethod;
 			if (killMethod == eKillMethod::NONE && mapMethod == eMapKillMethod::NONE)
@@ -104,193 +125,298 @@ public:
 		return spin;
 	}
 
-	static auto parse(std::string_view input) -> std::optional<RouletteSpin> {
-		std::vector<ParseConditionContext> contexts;
-		std::vector<std::string> tokens;
-		contexts.push_back(ParseConditionContext{tokens});
-		auto detectedMission = eMission::NONE;
-		auto processed = processInput(input);
-
-		while (parseCondition(processed, contexts.back())) {
-			auto mission = contexts.back().mission;
-			auto nextIndex = contexts.back().nextIndex;
-
-			if (detectedMission == eMission::NONE)
-				detectedMission = mission;
-			else if (mission != detectedMission)
-				return nullptr;
+	// Parses a spin, either written out as "Target: method / disguise, ..." or as keyword soup. On failure the returned spin
+	// has no mission and, if `error` is given, the reason is written to it.
+	static auto parse(std::string_view input, std::string* error = nullptr) -> std::optional<RouletteSpin> {
+		std::array<ParseConditionContext, maxConditions> contexts;
+		auto numContexts = parseContexts(input, contexts, error);
+		if (!numContexts) return nullptr;
+		return createSpinFromParseContexts(std::span{contexts}.first(numContexts), error);
+	}
 
-			contexts.push_back(ParseConditionContext{tokens});
-			contexts.back().nextIndex = nextIndex;
-			contexts.back().mission = mission;
-			contexts.back().conditions = contexts.size();
+	// Parses the conditions of a spin without building the spin. Returns the number of contexts written, or 0 if the
+	// input can't make a valid spin, writing the reason to `error` if given.
+	static auto parseContexts(std::string_view input, std::span<ParseConditionContext, maxConditions> contexts, std::string* error = nullptr) -> size_t {
+		if (auto numContexts = parseStructured(input, contexts))
+			return numContexts;
+
+		std::array<char, maxStackInput> inputBuffer;
+		std::string inputFallback;
+		auto buffer = std::span<char>{inputBuffer};
+		if (input.size() > buffer.size()) {
+			inputFallback.resize(input.size());
+			buffer = inputFallback;
+		}
+		auto processed = std::string_view{buffer.data(), normalizeInput(input, buffer)};
+
+		std::array<SpinToken, maxStackTokens> tokenBuffer;
+		std::vector<SpinToken> tokenFallback;
+		auto tokens = std::span<SpinToken>{tokenBuffer};
+		if (auto numTokens = countTokens(processed); numTokens > tokens.size()) {
+			tokenFallback.resize(numTokens);
+			tokens = tokenFallback;
 		}
+		tokens = tokens.first(tokenize(processed, tokens));
 
-		return createSpinFromParseContexts(contexts);
-	}
+		size_t numContexts = 1;
+		contexts[0] = {};
 
-	static auto parseCondition(std::string_view processed, ParseConditionContext& context) -> bool {
-		auto parseTargetToken = [&context](const std::string& token){
-			auto it = ::targetKeywords.find(token);
-			if (it != end(::targetKeywords)) {
-				if (context.target.empty()) {
-					context.target = Keyword::targetKeyToName(it->second);
-					context.mission = getMissionForTarget(context.target);
-				}
-				return true;
+		while (parseCondition(tokens, contexts[numContexts - 1])) {
+			auto mission = contexts[numContexts - 1].mission;
+			if (mission != contexts[0].mission) {
+				if (error) *error = "Targets from more than one mission.";
+				return 0;
 			}
-			return false;
-		};
-
-		auto parseToken = [&context, &parseTargetToken](const std::string& token){
-			auto parseTokenImpl = [&context, &parseTargetToken](const std::string& token, auto& parseTokenImpl) {
-				auto alreadyHaveTarget = !context.target.empty();
-				if (parseTargetToken(token))
-					return !alreadyHaveTarget;
-
-				auto kwit = Keyword::getMap().find(token);
-				if (kwit != end(Keyword::getMap())) {
-					if (std::visit(overloaded {
-						[&context](eKillType kt) { if (context.killType == eKillType::Any) context.killType = kt; return true; },
-						[&context](eKillMethod km) { if (context.killMethod == eKillMethod::NONE) context.killMethod = km; return true; },
-						[&context](eMapKillMethod mkm) { if (context.mapMethod == eMapKillMethod::NONE) context.mapMethod = mkm; return true; },
-						[&context](eKillComplication kc) { if (context.complication == eKillComplication::None) context.complication = kc; return true; },
-					}, kwit->second)) return true;
-				}
-
-				if (context.killMethod == eKillMethod::NONE && context.mapMethod == eMapKillMethod::NONE) {
-					auto it = ::methodKeywords.find(token);
-					if (it != end(::methodKeywords)) {
-						return parseTokenImpl(it->second, parseTokenImpl);
-					}
-				}
-
-				if (context.mission == eMission::NONE) return false;
-
-				for (auto& dkws : disguiseKeywords) {
-					if (!dkws.missions.empty() && !dkws.missions.contains(context.mission)) continue;
-					auto kwd = dkws.keywords.find(token);
-					if (kwd != end(dkws.keywords)) {
-						context.disguise = kwd->second;
-						return true;
-					}
-				}
-				return false;
-			};
-			return parseTokenImpl(token, parseTokenImpl);
-		};
+			if (numContexts == contexts.size())
+				break;
 
-		if (context.tokens.empty() && context.conditions == 0) {
-			auto token = std::string{};
+			contexts[numContexts] = {};
+			contexts[numContexts++].mission = mission;
+		}
 
-			for (auto c : processed) {
-				if (!isspace(c)) {
-					if (isalnum(c)) token += c;
-					continue;
-				}
+		return numContexts;
+	}
 
-				if (token.empty()) continue;
+	static auto countTokens(std::string_view processed) -> size_t {
+		size_t count = 0;
+		auto inToken = false;
+		for (auto c : processed) {
+			if (c != ' ' && !inToken) ++count;
+			inToken = c != ' ';
+		}
+		return count;
+	}
 
-				auto it = ::keywordKeywords.find(token);
+	// Splits normalised input into tokens, substituting common misspellings. Returns the number of tokens written.
+	static auto tokenize(std::string_view processed, std::span<SpinToken> tokens) -> size_t {
+		size_t count = 0;
+		size_t start = 0;
+
+		while (start < processed.size() && count < tokens.size()) {
+			auto end = processed.find(' ', start);
+			if (end == processed.npos) end = processed.size();
+			if (end != start) {
+				auto token = processed.substr(start, end - start);
+				auto keyword = ::keywordKeywords.find(token);
+				tokens[count++] = {keyword ? *keyword : token};
+			}
+			start = end + 1;
+		}
 
-				if (it != end(::keywordKeywords))
-					context.tokens.push_back(it->second);
-				else
-					context.tokens.push_back(move(token));
+		return count;
+	}
 
-				token = "";
+	static auto parseCondition(std::span<SpinToken> tokens, ParseConditionContext& context) -> bool {
+		auto parseTargetKeyword = [&context](const SpinKeyword& keyword){
+			if (keyword.target.empty()) return false;
+			if (context.target.empty()) {
+				context.target = keyword.targetName;
+				context.mission = keyword.targetMission;
 			}
+			return true;
+		};
 
-			if (!token.empty())
-				context.tokens.push_back(move(token));
-		}
+		auto parseKeyword = [&context, &parseTargetKeyword](const SpinKeyword& keyword){
+			auto alreadyHaveTarget = !context.target.empty();
+			if (parseTargetKeyword(keyword))
+				return !alreadyHaveTarget;
 
-		size_t i = context.nextIndex;
+			if (keyword.keyword || (!hasMethod(context) && !keyword.methodAlias.empty()))
+				return parseMethodKeyword(keyword, context);
+
+			return parseDisguiseKeyword(keyword, context);
+		};
 
 		if (context.mission == eMission::NONE) {
-			auto token = std::string{};
-
-			while (i < context.tokens.size()) {
-				auto tokensLeft = context.tokens.size() - i;
-				
-				switch (tokensLeft) {
-				default:
-				case 3:
-					token = context.tokens[i] + context.tokens[i + 1] + context.tokens[i + 2];
-					if (parseTargetToken(token)) {
-						context.tokens.erase(begin(context.tokens) + i, begin(context.tokens) + i + 3);
-						break;
-					}
-					[[fallthrough]];
-				case 2:
-					token = context.tokens[i] + context.tokens[i + 1];
-					if (parseTargetToken(token)) {
-						context.tokens.erase(begin(context.tokens) + i, begin(context.tokens) + i + 2);
-						break;
-					}
-					[[fallthrough]];
-				case 1:
-					if (parseTargetToken(context.tokens[i])) {
-						context.tokens.erase(begin(context.tokens) + i);
-						break;
-					}
-					++i;
-					continue;
-				case 0: break;
-				}
-				break;
+			for (size_t i = 0; i < tokens.size(); ++i) {
+				if (!tokens[i].consumed && matchLongest(tokens, i, 3, parseTargetKeyword))
+					break;
 			}
 
 			if (context.mission == eMission::NONE)
 				context.mission = eMission::BERLIN_APEXPREDATOR;
 		}
 
-		for (size_t i = 0; i < context.tokens.size(); ) {
-			auto tokensLeft = context.tokens.size() - i;
-			switch (tokensLeft) {
-			default:
-			case 4:
-				if (parseToken(context.tokens[i] + context.tokens[i+1] + context.tokens[i+2] + context.tokens[i + 3])) {
-					context.tokens.erase(begin(context.tokens) + i, begin(context.tokens) + i + 4);
-					break;
-				}
-				[[fallthrough]];
-			case 3:
-				if (parseToken(context.tokens[i] + context.tokens[i+1] + context.tokens[i+2])) {
-					context.tokens.erase(begin(context.tokens) + i, begin(context.tokens) + i + 3);
-					break;
-				}
-				[[fallthrough]];
-			case 2:
-				if (parseToken(context.tokens[i] + context.tokens[i+1])) {
-					context.tokens.erase(begin(context.tokens) + i, begin(context.tokens) + i + 2);
-					break;
-				}
-				[[fallthrough]];
-			case 1:
-				if (parseToken(context.tokens[i])) {
-					context.tokens.erase(begin(context.tokens) + i);
-					break;
-				}
-				else ++i;
-				break;
-			case 0: break;
-			}
+		for (size_t i = 0; i < tokens.size(); ++i) {
+			if (tokens[i].consumed) continue;
+			if (!matchLongest(tokens, i, 4, parseKeyword))
+				matchFuzzy(tokens, i, parseKeyword);
 
-			if (
-				(!context.target.empty() || context.mission == eMission::BERLIN_APEXPREDATOR)
-				&& !context.disguise.empty()
-				&& (context.killMethod != eKillMethod::NONE || context.mapMethod != eMapKillMethod::NONE)
-			)
+			if ((!context.target.empty() || context.mission == eMission::BERLIN_APEXPREDATOR) && !context.disguise.empty() && hasMethod(context))
 				break;
 		}
 
-		context.nextIndex = i;
-		return !context.target.empty()
-			&& !context.disguise.empty()
-			&& (context.killMethod != eKillMethod::NONE || context.mapMethod != eMapKillMethod::NONE);
+		return !context.target.empty() && !context.disguise.empty() && hasMethod(context);
 	}
 
 private:
+	static auto hasMethod(const ParseConditionContext& context) -> bool {
+		return context.killMethod != eKillMethod::NONE || context.mapMethod != eMapKillMethod::NONE;
+	}
+
+	// Applies a kill method, kill type or complication keyword, following method aliases if there's no method yet.
+	static auto parseMethodKeyword(const SpinKeyword& keyword, ParseConditionContext& context) -> bool {
+		if (keyword.keyword) {
+			std::visit(overloaded {
+				[&context](eKillType kt) { if (context.killType == eKillType::Any) context.killType = kt; },
+				[&context](eKillMethod km) { if (context.killMethod == eKillMethod::NONE) context.killMethod = km; },
+				[&context](eMapKillMethod mkm) { if (context.mapMethod == eMapKillMethod::NONE) context.mapMethod = mkm; },
+				[&context](eKillComplication kc) { if (context.complication == eKillComplication::None) context.complication = kc; },
+			}, *keyword.keyword);
+			return true;
+		}
+
+		if (hasMethod(context) || keyword.methodAlias.empty()) return false;
+		auto alias = getSpinKeywordTrie().find(keyword.methodAlias);
+		return alias && parseMethodKeyword(*alias, context);
+	}
+
+	// Applies a disguise keyword from the first of its groups that applies to the context's mission.
+	static auto parseDisguiseKeyword(const SpinKeyword& keyword, ParseConditionContext& context) -> bool {
+		if (context.mission == eMission::NONE) return false;
+
+		for (auto& [group, disguise] : keyword.disguises) {
+			auto& missions = disguiseKeywords[group].missions;
+			if (!missions.empty() && !missions.contains(context.mission)) continue;
+			context.disguise = disguise;
+			return true;
+		}
+		return false;
+	}
 
+	// Walks the trie through up to `maxTokens` unconsumed tokens starting at `start`, then tries the keywords
+	// found at each token boundary from longest to shortest. Matched tokens are marked consumed.
+	static auto matchLongest(std::span<SpinToken> tokens, size_t start, size_t maxTokens, auto&& parse) -> bool {
+		auto& trie = getSpinKeywordTrie();
+		std::array<const SpinKeyword*, 4> matches{};
+		std::array<size_t, 4> lastTokens{};
+		auto node = trie.root;
+		auto numMatched = size_t{0};
+
+		for (auto i = start; i < tokens.size() && numMatched < maxTokens; ++i) {
+			if (tokens[i].consumed) continue;
+			node = trie.next(node, tokens[i].text);
+			if (node == trie.npos) break;
+			matches[numMatched] = trie.get(node);
+			lastTokens[numMatched++] = i;
+		}
+
+		while (numMatched > 0) {
+			auto keyword = matches[--numMatched];
+			if (!keyword || !parse(*keyword)) continue;
+			for (auto i = start; i <= lastTokens[numMatched]; ++i)
+				tokens[i].consumed = true;
+			return true;
+		}
+		return false;
+	}
+
+	// Typo fallback for tokens with no exact keyword: retries the next one or two unconsumed tokens against keywords
+	// a few edits away, closest first. Short tokens are left alone as near matches for them are mostly noise, and
+	// the first letter has to match, as it nearly always does in a typo.
+	static auto matchFuzzy(std::span<SpinToken> tokens, size_t start, auto&& parse) -> bool {
+		auto& trie = getSpinKeywordTrie();
+		if (trie.find(tokens[start].text)) return false;
+
+		std::array<char, KeywordTrie<SpinKeyword>::maxFuzzyLength> text;
+		std::array<size_t, 2> lengths{};
+		std::array<size_t, 2> lastTokens{};
+		size_t numTokens = 0;
+		size_t length = 0;
+
+		for (auto i = start; i < tokens.size() && numTokens < lengths.size(); ++i) {
+			if (tokens[i].consumed) continue;
+			if (length + tokens[i].text.size() > text.size()) break;
+			std::copy(tokens[i].text.begin(), tokens[i].text.end(), text.begin() + length);
+			length += tokens[i].text.size();
+			lengths[numTokens] = length;
+			lastTokens[numTokens++] = i;
+		}
+
+		while (numTokens > 0) {
+			auto key = std::string_view{text.data(), lengths[--numTokens]};
+			auto maxDistance = key.size() >= 8 ? 2u : key.size() >= 4 ? 1u : 0u;
+			if (maxDistance == 0) continue;
+
+			std::array<KeywordTrie<SpinKeyword>::FuzzyMatch, 8> matches;
+			auto numMatches = trie.findFuzzy(key, maxDistance, matches, 1);
+			for (size_t m = 0; m < numMatches; ++m) {
+				if (matches[m].distance == 0 || !parse(*trie.get(matches[m].node))) continue;
+				for (auto i = start; i <= lastTokens[numTokens]; ++i)
+					tokens[i].consumed = true;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Normalises `text` into `buffer` with the spaces removed, as keywords spanning several words are stored.
+	static auto compactKey(std::string_view text, std::span<char> buffer) -> std::string_view {
+		if (text.size() > buffer.size()) return {};
+		auto length = normalizeInput(text, buffer);
+		auto end = std::remove(buffer.begin(), buffer.begin() + length, ' ');
+		return {buffer.data(), static_cast<size_t>(end - buffer.begin())};
+	}
+
+	// Parses spins written out as "Target: method / disguise, ..." the way the mod saves its history and the app
+	// sends them. Each field is only matched against the keywords that fit it, so a target key which is also a
+	// method keyword (e.g. "AR") is read correctly. Returns 0 if the input isn't in this form or a field isn't
+	// recognised, for the caller to parse it as keyword soup instead.
+	static auto parseStructured(std::string_view input, std::span<ParseConditionContext, maxConditions> contexts) -> size_t {
+		auto& trie = getSpinKeywordTrie();
+		std::array<char, 256> buffer;
+		std::array<SpinToken, 32> tokenBuffer;
+		size_t numContexts = 0;
+
+		for (size_t pos = 0; pos < input.size(); ) {
+			auto end = std::min(input.find(',', pos), input.size());
+			auto condition = input.substr(pos, end - pos);
+			pos = end + 1;
+
+			auto colon = condition.find(':');
+			auto slash = condition.find('/');
+			auto isCondition = colon < slash && slash != condition.npos
+				&& condition.find(':', colon + 1) == condition.npos && condition.find('/', slash + 1) == condition.npos;
+			if (!isCondition) {
+				if (condition.find_first_not_of(" \t\r\n") == condition.npos) continue;
+				return 0;
+			}
+			if (numContexts == contexts.size()) return 0;
+
+			auto& context = contexts[numContexts++];
+			context = {};
+
+			auto target = trie.find(compactKey(condition.substr(0, colon), buffer));
+			if (!target || target->target.empty()) return 0;
+			context.target = target->targetName;
+			context.mission = target->targetMission;
+			if (context.mission != contexts[0].mission) return 0;
+
+			auto methodText = condition.substr(colon + 1, slash - colon - 1);
+			if (methodText.size() > buffer.size()) return 0;
+			auto processed = std::string_view{buffer.data(), normalizeInput(methodText, buffer)};
+			auto tokens = std::span<SpinToken>{tokenBuffer};
+			if (countTokens(processed) > tokens.size()) return 0;
+			tokens = tokens.first(tokenize(processed, tokens));
+
+			auto parseMethod = [&context](const SpinKeyword& keyword) { return parseMethodKeyword(keyword, context); };
+			for (size_t i = 0; i < tokens.size(); ++i) {
+				if (!tokens[i].consumed && !matchLongest(tokens, i, 4, parseMethod))
+					matchFuzzy(tokens, i, parseMethod);
+			}
+			if (!hasMethod(context)) return 0;
+
+			auto disguiseText = trim(condition.substr(slash + 1));
+			auto mission = Missions::get(context.mission);
+			if (auto disguise = mission ? mission->getDisguiseByName(disguiseText) : nullptr) {
+				context.disguise = disguise->name;
+				continue;
+			}
+
+			auto disguise = trie.find(compactKey(disguiseText, buffer));
+			if (!disguise || !parseDisguiseKeyword(*disguise, context)) return 0;
+		}
+
+		return numContexts;
+	}
 };
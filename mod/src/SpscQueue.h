@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Fixed capacity lock-free ring buffer for exactly one producer thread and one consumer thread.
+// Items are filled and read in place, so a slot keeps whatever it allocated for reuse by later items.
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+	static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+	// Producer only. The slot the next push publishes, or null if the queue is full. It still holds the last item that
+	// was in it.
+	auto back() -> T* {
+		auto const tail = this->tail.load(std::memory_order_relaxed);
+		if (tail - this->head.load(std::memory_order_acquire) == Capacity) return nullptr;
+		return &this->items[tail & (Capacity - 1)];
+	}
+
+	// Producer only. Publishes the slot returned by back(). Only wakes the consumer if it's waiting, so a push is no
+	// syscall while the consumer keeps up.
+	auto push() -> void {
+		// Sequentially consistent with wait(): either the consumer sees this item before sleeping, or this sees it sleeping.
+		this->tail.store(this->tail.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+		if (this->sleeping.load(std::memory_order_seq_cst))
+			this->tail.notify_one();
+	}
+
+	// Consumer only. The oldest item, or null if the queue is empty. It's left in place until pop().
+	auto front() -> T* {
+		auto const head = this->head.load(std::memory_order_relaxed);
+		if (head == this->tail.load(std::memory_order_acquire)) return nullptr;
+		return &this->items[head & (Capacity - 1)];
+	}
+
+	// Consumer only. Hands the front slot back to the producer.
+	auto pop() -> void {
+		this->head.store(this->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	// Consumer only. Blocks while the queue is empty.
+	auto wait() -> void {
+		auto const head = this->head.load(std::memory_order_relaxed);
+		this->sleeping.store(true, std::memory_order_seq_cst);
+		if (this->tail.load(std::memory_order_seq_cst) == head)
+			this->tail.wait(head, std::memory_order_acquire);
+		this->sleeping.store(false, std::memory_order_relaxed);
+	}
+
+	// Any thread.
+	auto forEachSlot(auto&& func) -> void {
+		for (auto& item : this->items) func(item);
+	}
+
+private:
+	alignas(64) std::atomic<size_t> head = 0;
+	// Set by the consumer while it waits, for the producer to check before notifying.
+	std::atomic<bool> sleeping = false;
+	alignas(64) std::atomic<size_t> tail = 0;
+	std::array<T, Capacity> items;
+};
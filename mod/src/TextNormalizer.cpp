@@ -0,0 +1,140 @@
+#include "TextNormalizer.h"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define CROUPIER_NORMALIZER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+	// Output for each ASCII byte, 0 to drop it.
+	constexpr auto asciiTable = []{
+		std::array<char, 128> table{};
+		for (auto c = '0'; c <= '9'; ++c) table[c] = c;
+		for (auto c = 'a'; c <= 'z'; ++c) table[c] = c;
+		for (auto c = 'A'; c <= 'Z'; ++c) table[c] = static_cast<char>(c - 'A' + 'a');
+		for (auto c : {' ', '\t', '\n', '\v', '\f', '\r'}) table[c] = ' ';
+		return table;
+	}();
+
+	struct Transliteration {
+		char32_t first;
+		char32_t last;
+		std::string_view ascii;
+	};
+
+	// Latin-1 Supplement and Latin Extended-A letters, by range of code points sharing a transliteration.
+	constexpr Transliteration latinRanges[] = {
+		{0xC0, 0xC5, "a"}, {0xC6, 0xC6, "ae"}, {0xC7, 0xC7, "c"}, {0xC8, 0xCB, "e"}, {0xCC, 0xCF, "i"},
+		{0xD0, 0xD0, "d"}, {0xD1, 0xD1, "n"}, {0xD2, 0xD6, "o"}, {0xD8, 0xD8, "o"}, {0xD9, 0xDC, "u"},
+		{0xDD, 0xDD, "y"}, {0xDE, 0xDE, "th"}, {0xDF, 0xDF, "ss"},
+		{0xE0, 0xE5, "a"}, {0xE6, 0xE6, "ae"}, {0xE7, 0xE7, "c"}, {0xE8, 0xEB, "e"}, {0xEC, 0xEF, "i"},
+		{0xF0, 0xF0, "d"}, {0xF1, 0xF1, "n"}, {0xF2, 0xF6, "o"}, {0xF8, 0xF8, "o"}, {0xF9, 0xFC, "u"},
+		{0xFD, 0xFD, "y"}, {0xFE, 0xFE, "th"}, {0xFF, 0xFF, "y"},
+		{0x100, 0x105, "a"}, {0x106, 0x10D, "c"}, {0x10E, 0x111, "d"}, {0x112, 0x11B, "e"}, {0x11C, 0x123, "g"},
+		{0x124, 0x127, "h"}, {0x128, 0x131, "i"}, {0x132, 0x133, "ij"}, {0x134, 0x135, "j"}, {0x136, 0x138, "k"},
+		{0x139, 0x142, "l"}, {0x143, 0x14B, "n"}, {0x14C, 0x151, "o"}, {0x152, 0x153, "oe"}, {0x154, 0x159, "r"},
+		{0x15A, 0x161, "s"}, {0x162, 0x167, "t"}, {0x168, 0x173, "u"}, {0x174, 0x175, "w"}, {0x176, 0x178, "y"},
+		{0x179, 0x17E, "z"}, {0x17F, 0x17F, "s"},
+	};
+
+	constexpr char32_t latinFirst = 0xC0;
+	constexpr char32_t latinLast = 0x17F;
+
+	// Up to two ASCII characters for each code point in [latinFirst, latinLast], empty to drop it.
+	constexpr auto latinTable = []{
+		std::array<std::array<char, 2>, latinLast - latinFirst + 1> table{};
+		for (auto& range : latinRanges) {
+			for (auto cp = range.first; cp <= range.last; ++cp) {
+				for (size_t i = 0; i < range.ascii.size(); ++i)
+					table[cp - latinFirst][i] = range.ascii[i];
+			}
+		}
+		return table;
+	}();
+
+	auto isUnicodeSpace(char32_t cp) -> bool {
+		return cp == 0xA0 || cp == 0x1680 || (cp >= 0x2000 && cp <= 0x200A)
+			|| cp == 0x2028 || cp == 0x2029 || cp == 0x202F || cp == 0x205F || cp == 0x3000;
+	}
+
+	// Decodes the multi-byte sequence at input[pos], advancing pos past it. Returns 0 for invalid sequences.
+	auto decodeUtf8(std::string_view input, size_t& pos) -> char32_t {
+		auto lead = static_cast<uint8_t>(input[pos++]);
+		auto length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+		if (length == 0 || lead >= 0xF5) return 0;
+
+		char32_t cp = lead & (0x3F >> length);
+		for (auto i = 0; i < length; ++i, ++pos) {
+			if (pos >= input.size()) return 0;
+			auto byte = static_cast<uint8_t>(input[pos]);
+			if ((byte & 0xC0) != 0x80) return 0;
+			cp = (cp << 6) | (byte & 0x3F);
+		}
+
+		constexpr char32_t minimums[] = {0, 0x80, 0x800, 0x10000};
+		if (cp < minimums[length] || (cp >= 0xD800 && cp <= 0xDFFF)) return 0;
+		return cp;
+	}
+}
+
+auto normalizeInput(std::string_view input, std::span<char> output) -> size_t {
+	if (output.size() < input.size())
+		input = input.substr(0, output.size());
+
+	auto out = output.data();
+	size_t pos = 0;
+
+	while (pos < input.size()) {
+#ifdef CROUPIER_NORMALIZER_SSE2
+		// Pure-ASCII blocks of 16 bytes are classified and case folded together, then compacted if any byte is dropped.
+		if (input.size() - pos >= 16) {
+			auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+			if (_mm_movemask_epi8(chunk) == 0) {
+				auto inRange = [chunk](char lo, char hi) {
+					return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(lo - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8(hi + 1)));
+				};
+				auto upper = inRange('A', 'Z');
+				auto space = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), inRange('\t', '\r'));
+				auto keep = _mm_or_si128(_mm_or_si128(upper, space), _mm_or_si128(inRange('a', 'z'), inRange('0', '9')));
+				auto folded = _mm_add_epi8(chunk, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+				folded = _mm_or_si128(_mm_andnot_si128(space, folded), _mm_and_si128(space, _mm_set1_epi8(' ')));
+
+				auto mask = static_cast<unsigned>(_mm_movemask_epi8(keep));
+				if (mask == 0xFFFF) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out), folded);
+					out += 16;
+				}
+				else {
+					alignas(16) char block[16];
+					_mm_store_si128(reinterpret_cast<__m128i*>(block), folded);
+					for (; mask; mask &= mask - 1)
+						*out++ = block[std::countr_zero(mask)];
+				}
+
+				pos += 16;
+				continue;
+			}
+		}
+#endif
+
+		auto byte = static_cast<uint8_t>(input[pos]);
+		if (byte < 0x80) {
+			if (auto c = asciiTable[byte]) *out++ = c;
+			++pos;
+			continue;
+		}
+
+		auto cp = decodeUtf8(input, pos);
+		if (cp >= latinFirst && cp <= latinLast) {
+			for (auto c : latinTable[cp - latinFirst]) {
+				if (c) *out++ = c;
+			}
+		}
+		else if (isUnicodeSpace(cp)) *out++ = ' ';
+	}
+
+	return static_cast<size_t>(out - output.data());
+}
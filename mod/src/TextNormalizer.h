@@ -0,0 +1,17 @@
+#pragma once
+#include <span>
+#include <string>
+#include <string_view>
+
+// Normalises UTF-8 input for keyword matching in a single pass: ASCII letters are lowercased, digits are kept,
+// whitespace becomes ' ', Latin diacritics are transliterated (e.g. "é" -> "e", "ß" -> "ss") and everything
+// else, including punctuation and invalid UTF-8, is dropped.
+// The output is never longer than the input. Returns the number of bytes written to `output`; if `output` is
+// smaller than `input`, only as much of the input as fits is normalised.
+auto normalizeInput(std::string_view input, std::span<char> output) -> size_t;
+
+inline auto normalizeInput(std::string_view input) -> std::string {
+	auto result = std::string(input.size(), '\0');
+	result.resize(normalizeInput(input, result));
+	return result;
+}
@@ -1,14 +1,8 @@
 #pragma once
-#include "unac.h"
 #include <algorithm>
-#include <codecvt>
-#include <locale>
 #include <string>
 #include <string_view>
 #include <vector>
-//#include <unicode/utypes.h>
-//#include <unicode/unistr.h>
-//#include <unicode/translit.h>
 
 // helper type for the visitor #4
 template<class... Ts>
@@ -17,42 +11,71 @@ struct overloaded : Ts... { using Ts::operator()...; };
 template<class... Ts>
 overloaded(Ts...) -> overloaded<Ts...>;
 
-inline std::wstring widen(const std::string& str)
+// Converts UTF-8 to UTF-16 (or UTF-32 where wchar_t is 32 bits). Invalid sequences become U+FFFD.
+inline std::wstring widen(std::string_view str)
 {
-	std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converterX;
-	return converterX.from_bytes(str);
+	std::wstring result;
+	result.reserve(str.size());
+
+	for (size_t pos = 0; pos < str.size();) {
+		auto lead = static_cast<unsigned char>(str[pos++]);
+		auto length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+		char32_t cp = length ? lead & (0x3F >> length) : lead;
+		bool valid = lead < 0x80 || (length && lead < 0xF5);
+
+		for (auto i = 0; valid && i < length; ++i) {
+			auto byte = pos < str.size() ? static_cast<unsigned char>(str[pos]) : 0;
+			valid = (byte & 0xC0) == 0x80;
+			if (!valid) break;
+			cp = (cp << 6) | (byte & 0x3F);
+			++pos;
+		}
+
+		constexpr char32_t minimums[] = {0, 0x80, 0x800, 0x10000};
+		if (!valid || cp < minimums[length] || (cp >= 0xD800 && cp <= 0xDFFF))
+			cp = 0xFFFD;
+
+		if (sizeof(wchar_t) == 2 && cp >= 0x10000) {
+			result += static_cast<wchar_t>(0xD800 + ((cp - 0x10000) >> 10));
+			result += static_cast<wchar_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+		}
+		else result += static_cast<wchar_t>(cp);
+	}
+	return result;
 }
 
-inline std::string narrow(const std::wstring& wstr)
+// Converts UTF-16 (or UTF-32 where wchar_t is 32 bits) to UTF-8. Unpaired surrogates become U+FFFD.
+inline std::string narrow(std::wstring_view wstr)
 {
-	std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> converterX;
-	return converterX.to_bytes(wstr);
-}
+	std::string result;
+	result.reserve(wstr.size());
+
+	for (size_t pos = 0; pos < wstr.size(); ++pos) {
+		auto cp = static_cast<char32_t>(wstr[pos]);
 
-inline std::string removeDiacritics(const std::string& str) {
-	// UTF-8 std::string -> UTF-16 UnicodeString
-	//icu::UnicodeString source = icu::UnicodeString::fromUTF8(icu::StringPiece(str));
-	//
-	//// Transliterate UTF-16 UnicodeString
-	//UErrorCode status = U_ZERO_ERROR;
-	//icu::Transliterator* accentsConverter = icu::Transliterator::createInstance(
-	//	"NFD; [:M:] Remove; NFC", UTRANS_FORWARD, status);
-	//accentsConverter->transliterate(source);
-	//// TODO: handle errors with status
-	//
-	//// UTF-16 UnicodeString -> UTF-8 std::string
-	//std::string result;
-	//source.toUTF8String(result);
-	//return result;
-	size_t length;
-	char* out = nullptr;
-	if (unac_string("utf-8", str.c_str(), str.size(), &out, &length) == 0) {
-		auto outStr = std::string{out, length};
-		free(out);
-		return outStr;
+		if (cp >= 0xD800 && cp <= 0xDBFF && pos + 1 < wstr.size() && wstr[pos + 1] >= 0xDC00 && wstr[pos + 1] <= 0xDFFF)
+			cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<char32_t>(wstr[++pos]) - 0xDC00);
+		else if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+			cp = 0xFFFD;
+
+		if (cp < 0x80) result += static_cast<char>(cp);
+		else if (cp < 0x800) {
+			result += static_cast<char>(0xC0 | (cp >> 6));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else if (cp < 0x10000) {
+			result += static_cast<char>(0xE0 | (cp >> 12));
+			result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		else {
+			result += static_cast<char>(0xF0 | (cp >> 18));
+			result += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		}
 	}
-	if (out) free(out);
-	return str;
+	return result;
 }
 
 inline auto ltrim(std::string_view str, std::string_view delimiter = " \t\n\r") {
@@ -105,6 +128,8 @@ inline auto toUpperCase(std::string_view p_String) -> std::string
 
 struct InsensitiveCompareLexicographic
 {
+	using is_transparent = void;
+
 	auto operator()(std::string_view a, std::string_view b) const -> bool {
 		return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](unsigned char a, unsigned char b) {
 			return std::tolower(a) < std::tolower(b);
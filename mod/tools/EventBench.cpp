@@ -0,0 +1,164 @@
+#include "EventLog.h"
+#include "EventValueReader.h"
+#include "Events.h"
+#include "KillValidation.h"
+#include "SharedRouletteSpin.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Decodes the Kill and Pacify events of a recorded event log with both backends: a DOM (nlohmann::json and the
+// EventValue's JSON constructor) and EventValueReader's single pass, starting from the MessagePack payloads as recorded,
+// then again with the reader allocating from a per-event arena, and dispatches the payloads through EventSystem with an
+// arena as the mod's event worker does. Then validates each Kill against every kill method with KillValidator, from the
+// facts derived from the decoded value.
+// Reports events/sec and allocations per event for each, and fails if they decode anything differently.
+// Usage: event-bench <event log> [rounds]
+
+namespace {
+	std::atomic<size_t> numAllocations = 0;
+
+	struct Payload {
+		bool isKill;
+		std::vector<uint8_t> bytes;
+		nlohmann::json event;
+	};
+
+	template<typename TValue>
+	auto decodeDom(const std::vector<uint8_t>& bytes) -> TValue {
+		auto json = nlohmann::json::from_msgpack(bytes);
+		return TValue(json.at("Value"));
+	}
+
+	template<typename TValue>
+	auto decodeReader(const std::vector<uint8_t>& bytes, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) -> TValue {
+		EventEnvelope<TValue> event;
+		EventValueReader reader(event, resource);
+		nlohmann::json::sax_parse(bytes, &reader, nlohmann::json::input_format_t::msgpack);
+		return std::move(event.Value);
+	}
+
+	template<typename TDecode>
+	auto bench(const char* name, const std::vector<Payload>& payloads, int rounds, TDecode&& decode) -> void {
+		auto allocationsBefore = numAllocations.load();
+		auto start = std::chrono::steady_clock::now();
+		for (auto round = 0; round < rounds; ++round) {
+			for (auto& payload : payloads) decode(payload);
+		}
+		auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		auto numDecoded = static_cast<double>(payloads.size()) * rounds;
+		std::printf("%-8s %12.0f events/sec %8.1f allocations/event\n", name, numDecoded / elapsed, (numAllocations - allocationsBefore) / numDecoded);
+	}
+}
+
+auto operator new(size_t size) -> void* {
+	++numAllocations;
+	if (auto ptr = std::malloc(size ? size : 1)) return ptr;
+	throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+	std::free(ptr);
+}
+
+auto operator delete(void* ptr, size_t) noexcept -> void {
+	std::free(ptr);
+}
+
+auto main(int argc, char** argv) -> int {
+	if (argc < 2) {
+		std::fprintf(stderr, "Usage: event-bench <event log> [rounds]\n");
+		return 1;
+	}
+
+	auto path = argv[1];
+	auto rounds = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+	EventLogReader reader;
+	if (!reader.open(path)) {
+		std::fprintf(stderr, "Could not read '%s': %s\n", path, reader.error().c_str());
+		return 1;
+	}
+
+	std::vector<Payload> payloads;
+	for (EventLogRecord record; reader.read(record);) {
+		auto isKill = record.name == Event<Events::Kill>::Name;
+		if (isKill || record.name == Event<Events::Pacify>::Name)
+			payloads.push_back({isKill, nlohmann::json::to_msgpack(record.event), std::move(record.event)});
+	}
+	if (payloads.empty() || rounds <= 0) {
+		std::fprintf(stderr, "No Kill or Pacify events to decode.\n");
+		return 1;
+	}
+
+	size_t numMismatched = 0;
+	for (size_t i = 0; i < payloads.size(); ++i) {
+		auto& payload = payloads[i];
+		auto same = payload.isKill
+			? decodeDom<KillEventValue>(payload.bytes) == decodeReader<KillEventValue>(payload.bytes)
+			: decodeDom<PacifyEventValue>(payload.bytes) == decodeReader<PacifyEventValue>(payload.bytes);
+		if (!same) {
+			std::fprintf(stderr, "Backends disagree on event %zu: %s\n", i, nlohmann::json::from_msgpack(payload.bytes).dump().c_str());
+			++numMismatched;
+		}
+	}
+
+	std::printf("%zu Kill and Pacify events, %d rounds\n", payloads.size(), rounds);
+	bench("dom", payloads, rounds, [](const Payload& payload) {
+		if (payload.isKill) decodeDom<KillEventValue>(payload.bytes);
+		else decodeDom<PacifyEventValue>(payload.bytes);
+	});
+	bench("reader", payloads, rounds, [](const Payload& payload) {
+		if (payload.isKill) decodeReader<KillEventValue>(payload.bytes);
+		else decodeReader<PacifyEventValue>(payload.bytes);
+	});
+
+	std::array<std::byte, 64 * 1024> arenaBuffer;
+	std::pmr::monotonic_buffer_resource arena{arenaBuffer.data(), arenaBuffer.size()};
+	bench("arena", payloads, rounds, [&arena](const Payload& payload) {
+		if (payload.isKill) decodeReader<KillEventValue>(payload.bytes, &arena);
+		else decodeReader<PacifyEventValue>(payload.bytes, &arena);
+		arena.release();
+	});
+
+	EventSystem events;
+	events.listen<Events::Kill>([](const ServerEvent<Events::Kill>&) {});
+	events.listen<Events::Pacify>([](const ServerEvent<Events::Pacify>&) {});
+	bench("dispatch", payloads, rounds, [&events, &arena](const Payload& payload) {
+		events.handle(payload.isKill ? Events::Kill : Events::Pacify, std::span<const uint8_t>(payload.bytes), &arena);
+		arena.release();
+	});
+
+	std::vector<std::pair<KillEventValue, double>> kills;
+	for (auto& payload : payloads) {
+		if (payload.isKill) kills.emplace_back(KillEventValue(payload.event.at("Value")), payload.event.value("Timestamp", 0.0));
+	}
+	RouletteSpin spin;
+	SharedRouletteSpin sharedSpin(spin);
+	KillValidator validator;
+	size_t numValid = 0;
+	auto startValidate = std::chrono::steady_clock::now();
+	for (auto round = 0; round < rounds; ++round) {
+		for (auto& [kill, timestamp] : kills) {
+			auto facts = KillEventFacts(kill, timestamp);
+			for (auto method = eKillMethod::NONE; method <= eKillMethod::NeckSnap; method = static_cast<eKillMethod>(static_cast<int>(method) + 1))
+				numValid += validator.validate(eTargetID::Unknown, facts, method, eKillType::Any, sharedSpin).result == eKillValidationType::Valid;
+			for (auto method = eMapKillMethod::NONE; method <= eMapKillMethod::Steven_BombWaterScooter; method = static_cast<eMapKillMethod>(static_cast<int>(method) + 1))
+				numValid += validator.validate(eTargetID::Unknown, facts, method, eKillType::Any, sharedSpin).result == eKillValidationType::Valid;
+		}
+	}
+	auto validateElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startValidate).count();
+	auto numMethods = static_cast<double>(eKillMethod::NeckSnap) + static_cast<double>(eMapKillMethod::Steven_BombWaterScooter) + 2;
+	auto numValidated = static_cast<double>(kills.size()) * rounds;
+	std::printf("%-8s %12.0f events/sec %8.0f validations/event, %zu valid\n", "validate", numValidated / validateElapsed, numMethods, numValid / rounds);
+	return numMismatched ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+#include "EventLog.h"
+#include "Events.h"
+#include "KillValidation.h"
+#include "SharedRouletteSpin.h"
+#include "SpinParser.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Replays an event log recorded by the mod (`record_events true`) through EventSystem, decoding every event into its
+// typed value the same way the mod does, and reports events per second against the session's own running time.
+// Given the spin that was played, the events also drive the mod's spin tracking and kill validation, and the kill
+// validation of each condition is reported. Every round must dispatch, and validate, exactly what the first did.
+// Given a corpus too, the session is appended to it in kill-bench's format, expecting the validations it got. That's for
+// adding sessions recorded in game to the corpus, once the results have been checked against what the game showed.
+// Usage: event-replay <event log> [rounds] [spin] [kill corpus to append to]
+
+namespace {
+	using EventCounts = std::array<size_t, numEvents>;
+
+	constexpr std::array<std::string_view, 4> validationNames = {"Unknown", "Invalid", "Valid", "Incomplete"};
+
+	auto getValidations(const SharedRouletteSpin& shared) -> std::vector<std::pair<eKillValidationType, bool>> {
+		std::vector<std::pair<eKillValidationType, bool>> validations;
+		for (auto& kc : shared.killValidations)
+			validations.emplace_back(kc.correctMethod, kc.correctDisguise);
+		return validations;
+	}
+
+	template<size_t... Indices>
+	auto listenAll(EventSystem& events, EventCounts& counts, std::index_sequence<Indices...>) -> void {
+		(events.listen<static_cast<Events>(Indices)>([&counts](const ServerEvent<static_cast<Events>(Indices)>&) {
+			++counts[Indices];
+		}), ...);
+	}
+
+	// Returns the number of events that failed to decode.
+	// Every event is seen by the spin, if there is one, whether it's dispatched or not.
+	auto replay(EventSystem& events, SharedRouletteSpin* shared, const std::vector<EventLogRecord>& records, bool report) -> size_t {
+		size_t numErrors = 0;
+		for (size_t i = 0; i < records.size(); ++i) {
+			auto& record = records[i];
+			if (shared) shared->seeEvent(record.timestamp);
+			auto id = getEventByName(record.name);
+			if (!id) continue;
+
+			try {
+				events.handle(*id, record.event);
+			}
+			catch (const nlohmann::json::exception& ex) {
+				if (report) std::fprintf(stderr, "Event %zu (%s): %s\n", i, record.name.c_str(), ex.what());
+				++numErrors;
+			}
+		}
+		return numErrors;
+	}
+}
+
+auto main(int argc, char** argv) -> int {
+	if (argc < 2) {
+		std::fprintf(stderr, "Usage: event-replay <event log> [rounds] [spin] [kill corpus to append to]\n");
+		return 1;
+	}
+
+	auto path = argv[1];
+	auto rounds = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+	std::optional<RouletteSpin> spin;
+	if (argc > 3) {
+		spin = SpinParser::parse(argv[3]);
+		if (!spin || !spin->getMission()) {
+			std::fprintf(stderr, "Spin '%s' doesn't parse.\n", argv[3]);
+			return 1;
+		}
+	}
+
+	EventLogReader reader;
+	if (!reader.open(path)) {
+		std::fprintf(stderr, "Could not read '%s': %s\n", path, reader.error().c_str());
+		return 1;
+	}
+
+	std::vector<EventLogRecord> records;
+	for (EventLogRecord record; reader.read(record);)
+		records.push_back(std::move(record));
+	if (!reader.error().empty())
+		std::fprintf(stderr, "Stopped reading '%s' after %zu events: %s\n", path, records.size(), reader.error().c_str());
+	if (records.empty() || rounds <= 0) {
+		std::fprintf(stderr, "Nothing to replay.\n");
+		return 1;
+	}
+
+	// The spin tracking listeners go first, as they do in the mod.
+	KillValidator validator;
+	RouletteSpin emptySpin;
+	SharedRouletteSpin shared(spin ? *spin : emptySpin);
+	EventCounts counts{};
+	EventSystem events;
+	if (spin) shared.listen(events, validator);
+	listenAll(events, counts, std::make_index_sequence<numEvents>{});
+
+	auto startSession = [&] {
+		shared.playerSelectMission();
+		shared.playerStart();
+	};
+
+	startSession();
+	auto numErrors = replay(events, spin ? &shared : nullptr, records, true);
+	auto const expected = counts;
+	auto const expectedValidations = getValidations(shared);
+	size_t numHandled = 0;
+	for (auto count : expected) numHandled += count;
+
+	auto start = std::chrono::steady_clock::now();
+	for (auto round = 0; round < rounds; ++round) {
+		counts = {};
+		startSession();
+		replay(events, spin ? &shared : nullptr, records, false);
+		if (counts != expected) {
+			std::fprintf(stderr, "Round %d dispatched different events to the first.\n", round + 1);
+			return 1;
+		}
+		if (getValidations(shared) != expectedValidations) {
+			std::fprintf(stderr, "Round %d validated kills differently to the first.\n", round + 1);
+			return 1;
+		}
+	}
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	auto sessionTime = records.back().timestamp - records.front().timestamp;
+	auto numEventsReplayed = static_cast<double>(records.size()) * rounds;
+	std::printf("%zu events (%zu handled, %zu unknown), %zu failed to decode\n", records.size(), numHandled, records.size() - numHandled - numErrors, numErrors);
+	std::printf("%.0f events/sec\n", numEventsReplayed / elapsed);
+	if (sessionTime > 0)
+		std::printf("%.0fx real time over a %.0fs session\n", sessionTime * rounds / elapsed, sessionTime);
+
+	for (size_t i = 0; i < numEvents; ++i) {
+		if (expected[i]) std::printf("  %-28.*s %zu\n", static_cast<int>(eventNames[i].size()), eventNames[i].data(), expected[i]);
+	}
+
+	if (spin) {
+		std::printf("Kill validation:\n");
+		auto const& conditions = spin->getConditions();
+		for (size_t i = 0; i < conditions.size() && i < expectedValidations.size(); ++i) {
+			auto [method, disguise] = expectedValidations[i];
+			std::printf("  %zu. %-26s %-10s %s\n",
+				i + 1,
+				std::string(conditions[i].target.get().getName()).c_str(),
+				validationNames[static_cast<size_t>(method)].data(),
+				disguise ? "correct disguise" : "wrong disguise"
+			);
+		}
+	}
+	if (spin && argc > 4) {
+		auto session = nlohmann::json::object();
+		session["name"] = std::filesystem::path(path).stem().string();
+		session["spin"] = argv[3];
+		auto& expectedResults = session["expected"] = nlohmann::json::array();
+		for (auto [method, disguise] : expectedValidations)
+			expectedResults.push_back(validationNames[static_cast<size_t>(method)]);
+		auto& sessionEvents = session["events"] = nlohmann::json::array();
+		for (auto& record : records)
+			sessionEvents.push_back(record.event);
+
+		std::ofstream corpus(argv[4], std::ios::app);
+		corpus << session.dump() << '\n';
+		if (!corpus) {
+			std::fprintf(stderr, "Could not append to '%s'.\n", argv[4]);
+			return 1;
+		}
+		std::printf("Appended to %s as '%s'\n", argv[4], session["name"].get<std::string>().c_str());
+	}
+	return numErrors ? 1 : 0;
+}
@@ -0,0 +1,185 @@
+#include "EventSystem.h"
+#include "Events.h"
+#include "KillValidation.h"
+#include "SharedRouletteSpin.h"
+#include "SpinParser.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Replays a corpus of recorded sessions through SharedRouletteSpin and KillValidator as the mod does, and compares the
+// kill validation of each condition with the expected result. Reports a matrix of expected against actual results and
+// events/sec over the given number of rounds, and fails if any result differs.
+// Each line of the corpus is a JSON object: {"name": ..., "spin": <spin text>, "expected": [<eKillValidationType name
+// per condition>...], "events": [<events as sent to the server, with Name, Timestamp and Value>...]}. Events the mod has
+// no type for are only seen for their timestamp, as the first event after a load is.
+// Usage: kill-bench [corpus file] [rounds]
+
+namespace {
+	constexpr std::array<std::string_view, 4> validationNames = {"Unknown", "Invalid", "Valid", "Incomplete"};
+
+	auto getValidationTypeFromName(std::string_view name) -> std::optional<eKillValidationType> {
+		for (size_t i = 0; i < validationNames.size(); ++i) {
+			if (validationNames[i] == name) return static_cast<eKillValidationType>(i);
+		}
+		return std::nullopt;
+	}
+
+	struct SessionEvent {
+		std::optional<Events> id;
+		double timestamp = 0;
+		nlohmann::json json;
+	};
+
+	struct Session {
+		std::string name;
+		RouletteSpin spin;
+		std::vector<eKillValidationType> expected;
+		std::vector<SessionEvent> events;
+	};
+
+	auto loadSession(const std::string& line, Session& session, std::string& error) -> bool {
+		auto json = nlohmann::json::parse(line, nullptr, false);
+		if (!json.is_object()) {
+			error = "not a JSON object";
+			return false;
+		}
+
+		session.name = json.value("name", "");
+		auto spin = SpinParser::parse(json.value("spin", ""));
+		if (!spin || !spin->getMission()) {
+			error = "spin doesn't parse";
+			return false;
+		}
+		session.spin = std::move(*spin);
+
+		for (auto& expected : json.value("expected", nlohmann::json::array())) {
+			auto type = expected.is_string() ? getValidationTypeFromName(expected.get<std::string>()) : std::nullopt;
+			if (!type) {
+				error = "unknown expected result " + expected.dump();
+				return false;
+			}
+			session.expected.push_back(*type);
+		}
+		if (session.expected.size() != session.spin.getConditions().size()) {
+			error = "expected results don't match the spin's conditions";
+			return false;
+		}
+
+		for (auto& event : json.value("events", nlohmann::json::array())) {
+			if (!event.is_object() || !event.value("Timestamp", nlohmann::json()).is_number()) {
+				error = "event without a timestamp " + event.dump();
+				return false;
+			}
+			auto id = getEventByName(event.value("Name", ""));
+			auto timestamp = event["Timestamp"].get<double>();
+			session.events.push_back({id, timestamp, std::move(event)});
+		}
+		return true;
+	}
+}
+
+auto main(int argc, char** argv) -> int {
+	auto path = argc > 1 ? argv[1] : CROUPIER_KILL_CORPUS;
+	auto rounds = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+	std::ifstream file(path);
+	if (!file) {
+		std::fprintf(stderr, "Could not open corpus '%s'.\n", path);
+		return 1;
+	}
+
+	std::vector<Session> sessions;
+	size_t lineNumber = 0;
+	for (std::string line; std::getline(file, line);) {
+		++lineNumber;
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty()) continue;
+
+		std::string error;
+		if (!loadSession(line, sessions.emplace_back(), error)) {
+			std::fprintf(stderr, "%s:%zu: %s\n", path, lineNumber, error.c_str());
+			return 1;
+		}
+	}
+	if (sessions.empty() || rounds <= 0) {
+		std::fprintf(stderr, "No sessions to replay.\n");
+		return 1;
+	}
+
+	// One spin tracked across sessions through the same listeners as the mod, which keeps its SharedRouletteSpin and
+	// swaps the spin it follows as missions are spun.
+	KillValidator validator;
+	RouletteSpin spin;
+	SharedRouletteSpin shared(spin);
+	EventSystem events;
+	shared.listen(events, validator);
+
+	std::array<std::byte, 64 * 1024> arenaBuffer;
+	std::pmr::monotonic_buffer_resource arena{arenaBuffer.data(), arenaBuffer.size()};
+	// Spins can't be copied, so the session's is lent to the tracked spin while it's replayed. The kill validations are
+	// left for checking afterwards.
+	auto replay = [&](Session& session) {
+		std::swap(spin, session.spin);
+		shared.playerSelectMission();
+		shared.playerStart();
+		for (auto& event : session.events) {
+			shared.seeEvent(event.timestamp);
+			if (!event.id) continue;
+			events.handle(*event.id, event.json, &arena);
+			arena.release();
+		}
+		std::swap(spin, session.spin);
+	};
+
+	std::array<std::array<size_t, validationNames.size()>, validationNames.size()> matrix{};
+	size_t numMismatched = 0;
+	size_t numEvents = 0;
+	for (auto& session : sessions) {
+		replay(session);
+		numEvents += session.events.size();
+
+		for (size_t i = 0; i < session.expected.size(); ++i) {
+			auto expected = session.expected[i];
+			auto actual = shared.killValidations[i].correctMethod;
+			++matrix[static_cast<size_t>(expected)][static_cast<size_t>(actual)];
+			if (actual == expected) continue;
+
+			std::fprintf(stderr, "%s: condition %zu (%s) expected %s, got %s\n",
+				session.name.c_str(),
+				i + 1,
+				std::string(session.spin.getConditions()[i].target.get().getName()).c_str(),
+				validationNames[static_cast<size_t>(expected)].data(),
+				validationNames[static_cast<size_t>(actual)].data()
+			);
+			++numMismatched;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (auto round = 0; round < rounds; ++round) {
+		for (auto& session : sessions)
+			replay(session);
+	}
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::printf("%zu sessions, %zu events, %d rounds, %zu mismatched\n", sessions.size(), numEvents, rounds, numMismatched);
+	std::printf("%-12s", "expected");
+	for (auto name : validationNames) std::printf("%12s", name.data());
+	std::printf("\n");
+	for (size_t expected = 0; expected < validationNames.size(); ++expected) {
+		std::printf("%-12s", validationNames[expected].data());
+		for (auto count : matrix[expected]) std::printf("%12zu", count);
+		std::printf("\n");
+	}
+	std::printf("%.0f events/sec\n", static_cast<double>(numEvents) * rounds / elapsed);
+	return numMismatched ? 1 : 0;
+}
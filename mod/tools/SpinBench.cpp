@@ -0,0 +1,75 @@
+#include "SpinParser.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Parses every line of a spin corpus repeatedly, reporting parses per second and heap allocations per parse.
+// Usage: spin-bench [corpus file] [rounds]
+
+namespace {
+	std::atomic<size_t> numAllocations = 0;
+}
+
+auto operator new(size_t size) -> void* {
+	++numAllocations;
+	if (auto ptr = std::malloc(size ? size : 1)) return ptr;
+	throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+	std::free(ptr);
+}
+
+auto operator delete(void* ptr, size_t) noexcept -> void {
+	std::free(ptr);
+}
+
+auto main(int argc, char** argv) -> int {
+	auto path = argc > 1 ? argv[1] : CROUPIER_SPIN_CORPUS;
+	auto rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+	std::ifstream file(path);
+	if (!file) {
+		std::fprintf(stderr, "Could not open corpus '%s'.\n", path);
+		return 1;
+	}
+
+	std::vector<std::string> corpus;
+	for (std::string line; std::getline(file, line);) {
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (!line.empty()) corpus.push_back(std::move(line));
+	}
+	if (corpus.empty() || rounds <= 0) {
+		std::fprintf(stderr, "Nothing to parse.\n");
+		return 1;
+	}
+
+	// Warm up once so building the keyword index isn't counted.
+	size_t numFailed = 0;
+	for (const auto& line : corpus) {
+		auto spin = SpinParser::parse(line);
+		if (!spin || !spin->getMission()) {
+			std::fprintf(stderr, "Failed to parse: %s\n", line.c_str());
+			++numFailed;
+		}
+	}
+
+	auto allocationsBefore = numAllocations.load();
+	auto start = std::chrono::steady_clock::now();
+
+	for (auto i = 0; i < rounds; ++i) {
+		for (const auto& line : corpus)
+			SpinParser::parse(line);
+	}
+
+	auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	auto numParses = static_cast<double>(corpus.size()) * rounds;
+	std::printf("%zu spins, %d rounds, %zu failed\n", corpus.size(), rounds, numFailed);
+	std::printf("%.0f parses/sec, %.2f allocations/parse\n", numParses / seconds, (numAllocations - allocationsBefore) / numParses);
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include "Roulette.h"
+#include "RouletteMission.h"
+#include "RouletteRuleset.h"
+#include <charconv>
+#include <cstring>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Writes spins generated for every mission, one per line, each in both of the forms spins are written in:
+// with keywords, as the mod saves its spin history, and with the full names shown in the UI.
+// Usage: spin-corpus [spins per mission] [directory to also write one file per spin, for seeding a fuzzer]
+
+namespace {
+	auto formatKeywords(const RouletteSpin& spin) -> std::string {
+		std::string result;
+		for (const auto& cond : spin.getConditions()) {
+			if (!result.empty()) result += ", ";
+			result += Keyword::getForTarget(cond.target.get().getName());
+			result += ": ";
+			if (cond.killComplication != eKillComplication::None)
+				result += std::format("({}) ", Keyword::get(cond.killComplication));
+			if (cond.killType != eKillType::Any)
+				result += std::format("{} ", Keyword::get(cond.killType));
+			result += cond.killMethod.method != eKillMethod::NONE ? Keyword::get(cond.killMethod.method) : Keyword::get(cond.specificKillMethod.method);
+			result += " / ";
+			result += cond.disguise.get().name;
+		}
+		return result;
+	}
+
+	auto formatNames(const RouletteSpin& spin) -> std::string {
+		std::string result;
+		for (const auto& cond : spin.getConditions()) {
+			if (!result.empty()) result += ", ";
+			result += std::format("{}: {} / {}", cond.target.get().getName(), cond.methodName, cond.disguise.get().name);
+		}
+		return result;
+	}
+}
+
+auto main(int argc, char** argv) -> int {
+	auto spinsPerMission = 20;
+	if (argc > 1) std::from_chars(argv[1], argv[1] + std::strlen(argv[1]), spinsPerMission);
+	auto splitDir = argc > 2 ? std::filesystem::path(argv[2]) : std::filesystem::path();
+	if (!splitDir.empty()) std::filesystem::create_directories(splitDir);
+
+	auto ruleset = makeRouletteRuleset(eRouletteRuleset::Default);
+	RouletteSpinGenerator generator;
+	generator.setRuleset(&ruleset);
+
+	std::vector<std::string> lines;
+	for (const auto& info : missionInfos) {
+		auto mission = Missions::get(info.mission);
+		if (!mission || mission->getTargets().empty()) continue;
+		generator.setMission(mission);
+
+		for (auto i = 0; i < spinsPerMission; ++i) {
+			try {
+				auto spin = generator.spin();
+				lines.push_back(formatKeywords(spin));
+				lines.push_back(formatNames(spin));
+			}
+			catch (const RouletteGeneratorException& ex) {
+				std::fprintf(stderr, "%s: %s\n", std::string(info.name).c_str(), ex.what());
+				break;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < lines.size(); ++i) {
+		std::printf("%s\n", lines[i].c_str());
+
+		if (!splitDir.empty()) {
+			std::ofstream file(splitDir / std::format("spin{:05}.txt", i), std::ios::binary);
+			file << lines[i];
+		}
+	}
+	return 0;
+}
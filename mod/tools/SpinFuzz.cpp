@@ -0,0 +1,19 @@
+#include "SpinImport.h"
+#include "SpinParser.h"
+#include "TextNormalizer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// libFuzzer entry point, feeding arbitrary bytes to the spin parser the same ways untrusted text reaches it.
+extern "C" auto LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) -> int {
+	auto input = std::string_view{reinterpret_cast<const char*>(data), size};
+
+	normalizeInput(input);
+	SpinParser::parse(input);
+
+	// Multi-line input goes through the history importer, which splits lines and parses them in parallel.
+	if (input.find('\n') != input.npos)
+		importSpins(input, 2);
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include "EventTimeline.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+// Checks that event timelines stay bounded as the mod compacts them over a long session, and that what a load rewinds
+// to is still there afterwards. Fails with the first check that doesn't hold.
+// Usage: timeline-check
+
+namespace {
+	struct Setpiece {
+		std::string name;
+		double timestamp;
+	};
+
+	// As SharedRouletteSpin compacts its timelines.
+	constexpr double lookBack = 30;
+
+	auto check(bool condition, const char* what) -> bool {
+		if (!condition) std::fprintf(stderr, "Failed: %s\n", what);
+		return condition;
+	}
+}
+
+auto main() -> int {
+	NamedEventTimeline<Setpiece, &Setpiece::name> timeline;
+	auto ok = true;
+
+	// A setpiece from long before the rest, which a load can fall back to.
+	timeline.add({"Silvio_InPlane", 1});
+
+	// A long freeform session repeating the same setpiece every second.
+	constexpr size_t numEvents = 100000;
+	size_t maxSize = 0;
+	size_t maxNamed = 0;
+	for (size_t i = 0; i < numEvents; ++i) {
+		auto const timestamp = 10.0 + static_cast<double>(i);
+		timeline.add({"Door_Opened", timestamp});
+		timeline.compactBefore(timestamp - lookBack);
+		maxSize = std::max(maxSize, timeline.size());
+		maxNamed = std::max(maxNamed, timeline.countNamed("Door_Opened"));
+	}
+
+	ok &= check(maxNamed <= lookBack + 2, "a name's entries stay within the look-back after compaction");
+	ok &= check(maxSize <= lookBack + 2, "the timeline stays within the look-back after compaction");
+	ok &= check(timeline.countNamed("Silvio_InPlane") == 1, "the last entry of a name from before compaction is kept");
+
+	auto const last = 10.0 + static_cast<double>(numEvents - 1);
+	auto latest = timeline.latestNamed("Door_Opened");
+	ok &= check(latest && latest->timestamp == last, "the latest entry of a name is found");
+
+	// A load rewinding to a few seconds ago falls back to the entries left from then.
+	timeline.truncateAfter(last - 5);
+	latest = timeline.latestNamed("Door_Opened");
+	ok &= check(latest && latest->timestamp == last - 5, "truncating falls back to the latest entry left");
+	latest = timeline.latestNamed("Silvio_InPlane");
+	ok &= check(latest && latest->timestamp == 1, "truncating keeps a compacted name's last entry");
+
+	// Rewinding before the compacted entries drops names with nothing left.
+	timeline.truncateAfter(0);
+	ok &= check(!timeline.latestNamed("Silvio_InPlane") && !timeline.latestNamed("Door_Opened"), "truncating before every entry of a name drops it");
+
+	std::printf("%zu events, at most %zu kept, at most %zu of one name\n", numEvents, maxSize, maxNamed);
+	return ok ? 0 : 1;
+}